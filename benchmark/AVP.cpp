@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <thread>
 #include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
 
 namespace AVP
 {
@@ -275,11 +276,18 @@ namespace AVP
 
         ByteArray array(avp.calculateLength(true));
 
+        auto allocations = AllocationCounter::allocations();
+
         for (auto _ : state)
         {
             array.clear();
             avp.deploy(array);
         }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
     }
 
     static void DeployNewByteArray(benchmark::State& state)
@@ -290,10 +298,17 @@ namespace AVP
             ByteArray::fromHex("AABBCCDDEEFF")
         );
 
+        auto allocations = AllocationCounter::allocations();
+
         for (auto _ : state)
         {
             benchmark::DoNotOptimize(avp.deploy());
         }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
     }
 }
 
@@ -450,6 +450,54 @@ namespace AVP { namespace Data
 
         state.SetComplexityN(state.range(0));
     }
+
+    static Diameter::AVP unsigned64(uint32_t code, uint64_t value)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+            )
+            .setData(
+                Diameter::AVP::Data()
+                    .setUnsigned64(value)
+            )
+            .updateLength();
+    }
+
+    static Diameter::AVP grouped(uint32_t code, Diameter::AVP::Data data)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+            )
+            .setData(std::move(data))
+            .updateLength();
+    }
+
+    static void BuildNestedAndDeploy(benchmark::State& state)
+    {
+        ByteArray array(1024);
+
+        for (auto _ : state)
+        {
+            // Multiple-Services-Credit-Control -> Used-Service-Unit -> CC-*-Octets
+            auto avp = grouped(456, Diameter::AVP::Data()
+                .addAVP(grouped(446, Diameter::AVP::Data()
+                    .addAVP(unsigned64(421, 3000))
+                    .addAVP(unsigned64(412, 1000))
+                    .addAVP(unsigned64(414, 2000))
+                ))
+                .addAVP(unsigned64(432, 1))
+            );
+
+            array.clear();
+            avp.deploy(array);
+
+            benchmark::DoNotOptimize(array.data());
+        }
+    }
 }}
 
 BENCHMARK_NS(AVP::Data::DefaultConstruction);
@@ -497,4 +545,5 @@ BENCHMARK_NS(AVP::Data::DeployAlreadyAllocated)
     ->Complexity();
 BENCHMARK_NS(AVP::Data::DeployNewByteArray)
     ->Range(1, 1 << 10)
-    ->Complexity();
\ No newline at end of file
+    ->Complexity();
+BENCHMARK_NS(AVP::Data::BuildNestedAndDeploy);
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/Arena.hpp>
+#include <Diameter/Packet.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
+
+namespace {
+    const ByteArray answer = ByteArray::fromHex(
+            "010000648000011a000000007ddf9367"
+            "c15ecb1200000108400000206e312e63"
+            "7573746f6d2e7463702e736572766572"
+            "2e636f6d000001114000000c00000000"
+            "0000012840000021637573746f6d2e74"
+            "657374696e672e7365727665722e636f"
+            "6d000000"
+    );
+
+    void countAllocations(benchmark::State& state, uint64_t allocations)
+    {
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+}
+
+namespace Arena
+{
+    static void ParseLazyHeap(benchmark::State& state)
+    {
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            Diameter::Packet packet;
+
+            Diameter::Packet::tryParse(answer.data(), answer.size(), packet, Diameter::Packet::ParseMode::Lazy);
+
+            benchmark::DoNotOptimize(packet.find(264));
+        }
+
+        countAllocations(state, allocations);
+    }
+
+    static void ParseLazyArena(benchmark::State& state)
+    {
+        Diameter::Arena arena;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            arena.reset();
+
+            Diameter::Packet packet(arena);
+
+            Diameter::Packet::tryParse(answer.data(), answer.size(), packet, Diameter::Packet::ParseMode::Lazy);
+
+            benchmark::DoNotOptimize(packet.find(264));
+        }
+
+        countAllocations(state, allocations);
+    }
+
+    static void ParseEagerArena(benchmark::State& state)
+    {
+        Diameter::Arena arena;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            arena.reset();
+
+            Diameter::Packet packet(arena);
+
+            Diameter::Packet::tryParse(answer.data(), answer.size(), packet, Diameter::Packet::ParseMode::Eager);
+
+            benchmark::DoNotOptimize(packet.find(264));
+        }
+
+        countAllocations(state, allocations);
+    }
+}
+
+BENCHMARK_NS(Arena::ParseLazyHeap);
+BENCHMARK_NS(Arena::ParseLazyArena);
+BENCHMARK_NS(Arena::ParseEagerArena);
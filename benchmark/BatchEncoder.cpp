@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/BatchEncoder.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
+
+namespace {
+    const ByteArray answer = ByteArray::fromHex(
+            "010000648000011a000000007ddf9367"
+            "c15ecb1200000108400000206e312e63"
+            "7573746f6d2e7463702e736572766572"
+            "2e636f6d000001114000000c00000000"
+            "0000012840000021637573746f6d2e74"
+            "657374696e672e7365727665722e636f"
+            "6d000000"
+    );
+}
+
+namespace BatchEncoder
+{
+    static void EncodeBurst(benchmark::State& state)
+    {
+        std::vector<Diameter::Packet> packets(
+            static_cast<std::size_t>(state.range(0)),
+            Diameter::Packet(answer)
+        );
+
+        ByteArray buffer;
+        std::vector<std::size_t> offsets;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            buffer.clear();
+            offsets.clear();
+
+            Diameter::BatchEncoder::encode(packets, buffer, offsets);
+
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    static void DeployEachAndCopy(benchmark::State& state)
+    {
+        std::vector<Diameter::Packet> packets(
+            static_cast<std::size_t>(state.range(0)),
+            Diameter::Packet(answer)
+        );
+
+        ByteArray buffer;
+        std::vector<std::size_t> offsets;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            buffer.clear();
+            offsets.clear();
+
+            for (auto& packet : packets)
+            {
+                offsets.push_back(buffer.size());
+                buffer.append(packet.deploy());
+            }
+
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_NS(BatchEncoder::EncodeBurst)
+    ->Range(1, 1 << 6)
+    ->Complexity();
+BENCHMARK_NS(BatchEncoder::DeployEachAndCopy)
+    ->Range(1, 1 << 6)
+    ->Complexity();
@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/BatchParser.hpp>
+#include <iostream>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    static const ByteArray binaryDPR = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+    );
+
+    ByteArray generateBuffer(int64_t messages)
+    {
+        ByteArray buffer;
+
+        for (int64_t i = 0; i < messages; ++i)
+        {
+            buffer.append(binaryDPR);
+        }
+
+        return buffer;
+    }
+}
+
+namespace BatchParser
+{
+    static void SplitViews(benchmark::State& state)
+    {
+        auto buffer = generateBuffer(state.range(0));
+
+        std::vector<Diameter::PacketView> views;
+        std::size_t consumed;
+
+        for (auto _ : state)
+        {
+            views.clear();
+
+            benchmark::DoNotOptimize(
+                Diameter::BatchParser::split(buffer.data(), buffer.size(), views, consumed)
+            );
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void SplitViewsOneByOne(benchmark::State& state)
+    {
+        auto buffer = generateBuffer(state.range(0));
+
+        std::vector<Diameter::PacketView> views;
+
+        for (auto _ : state)
+        {
+            views.clear();
+
+            for (uint32_t offset = 0; offset < buffer.size(); )
+            {
+                Diameter::Packet::Header header(buffer.mid(offset, Diameter::Packet::Header::Size));
+
+                if (!header.isValid())
+                {
+                    break;
+                }
+
+                views.emplace_back(buffer.data() + offset, header.messageLength());
+
+                offset += header.messageLength();
+            }
+
+            benchmark::DoNotOptimize(views);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void ParsePackets(benchmark::State& state)
+    {
+        auto buffer = generateBuffer(state.range(0));
+
+        std::vector<Diameter::Packet> packets;
+        std::size_t consumed;
+
+        for (auto _ : state)
+        {
+            packets.clear();
+
+            benchmark::DoNotOptimize(
+                Diameter::BatchParser::parse(buffer.data(), buffer.size(), packets, consumed)
+            );
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void ParsePacketsOneByOne(benchmark::State& state)
+    {
+        auto buffer = generateBuffer(state.range(0));
+
+        std::vector<Diameter::Packet> packets;
+
+        for (auto _ : state)
+        {
+            packets.clear();
+
+            for (uint32_t offset = 0; offset < buffer.size(); )
+            {
+                Diameter::Packet::Header header(buffer.mid(offset, Diameter::Packet::Header::Size));
+
+                if (!header.isValid())
+                {
+                    break;
+                }
+
+                packets.emplace_back(buffer.mid(offset, header.messageLength()));
+
+                offset += header.messageLength();
+            }
+
+            benchmark::DoNotOptimize(packets);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK_NS(BatchParser::SplitViews)
+    ->Range(1, 1 << 8);
+BENCHMARK_NS(BatchParser::SplitViewsOneByOne)
+    ->Range(1, 1 << 8);
+BENCHMARK_NS(BatchParser::ParsePackets)
+    ->Range(1, 1 << 8);
+BENCHMARK_NS(BatchParser::ParsePacketsOneByOne)
+    ->Range(1, 1 << 8);
@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/CompactPacket.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
+
+namespace {
+    const ByteArray binaryCER = ByteArray::fromHex(
+        "010001b880000101000000007ddf9e97"
+        "c15f0a0a000001084000000f64726532"
+        "30313700000001024000000c00000000"
+        "000001024000000c0000000400000102"
+        "4000000c01000016000001024000000c"
+        "01000014000001024000000c01000032"
+        "000001024000000c0100002300000102"
+        "4000000c01000024000001024000000c"
+        "01000033000001024000000c01000001"
+        "000001024000000c0100000000000102"
+        "4000000c01000056000001024000000c"
+        "01000057000001024000000c0000000a"
+        "000001024000000c0100000600000102"
+        "4000000c00000003000001024000000c"
+        "01000066000001024000000c01000038"
+        "000001024000000c0100003000000102"
+        "4000000c01000031000001024000000c"
+        "0000d90500000128400000256d6e6330"
+        "30322e6d63633235302e336770706e65"
+        "74776f726b2e6f72670000000000010d"
+        "000000144954532d4469616d65746572"
+        "0000012b4000000c000000010000012b"
+        "4000000c00000000000001014000000e"
+        "0001c0a806610000000001014000000e"
+        "0001c0a8066100000000010a4000000c"
+        "000000000000010b0000000c00000001"
+        "000001094000000c000028af00000103"
+        "4000000c00000003"
+    );
+
+    // Codes of typical routing lookups. Last one is absent.
+    const uint32_t lookupCodes[] = {264, 296, 258, 266, 269, 263};
+
+    void countAllocations(benchmark::State& state, uint64_t allocations)
+    {
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+}
+
+namespace CompactPacket
+{
+    static void ParsingCER(benchmark::State& state)
+    {
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Diameter::CompactPacket(binaryCER));
+        }
+
+        countAllocations(state, allocations);
+    }
+
+    static void ParsingCERReused(benchmark::State& state)
+    {
+        Diameter::CompactPacket packet;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            Diameter::CompactPacket::tryParse(binaryCER.data(), binaryCER.size(), packet);
+
+            benchmark::DoNotOptimize(packet);
+        }
+
+        countAllocations(state, allocations);
+    }
+
+    static void FindCER(benchmark::State& state)
+    {
+        Diameter::CompactPacket packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            for (auto code : lookupCodes)
+            {
+                benchmark::DoNotOptimize(packet.find(code));
+            }
+        }
+    }
+
+    static void IsValidCER(benchmark::State& state)
+    {
+        Diameter::CompactPacket packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(packet.isValid());
+        }
+    }
+
+    static void DeployCER(benchmark::State& state)
+    {
+        Diameter::CompactPacket packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(packet.deploy());
+        }
+    }
+
+    static void ToPacketCER(benchmark::State& state)
+    {
+        Diameter::CompactPacket packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(packet.toPacket());
+        }
+    }
+}
+
+BENCHMARK_NS(CompactPacket::ParsingCER);
+BENCHMARK_NS(CompactPacket::ParsingCERReused);
+BENCHMARK_NS(CompactPacket::FindCER);
+BENCHMARK_NS(CompactPacket::IsValidCER);
+BENCHMARK_NS(CompactPacket::DeployCER);
+BENCHMARK_NS(CompactPacket::ToPacketCER);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/Encoder.hpp>
+#include <Diameter/Packet.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
+
+namespace {
+    const Diameter::AVP::Header::Flags mandatory = Diameter::AVP::Header::Flags()
+        .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true);
+
+    Diameter::Packet::Header requestHeader()
+    {
+        return Diameter::Packet::Header()
+            .setCommandFlags(
+                Diameter::Packet::Header::Flags()
+                    .setFlag(Diameter::Packet::Header::Flags::Bits::Request, true)
+            )
+            .setCommandCode(272)
+            .setApplicationId(4);
+    }
+}
+
+namespace Encoder
+{
+    static void EncodeCCR(benchmark::State& state)
+    {
+        auto session = ByteArray::fromASCII("client.example.com;1234;5678");
+        auto host = ByteArray::fromASCII("client.example.com");
+        auto realm = ByteArray::fromASCII("example.com");
+        auto destinationRealm = ByteArray::fromASCII("server.example.com");
+
+        auto header = requestHeader();
+
+        uint8_t buffer[1024];
+
+        uint32_t number = 0;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            Diameter::Encoder encoder(buffer, sizeof(buffer));
+
+            encoder
+                .beginMessage(header)
+                    .putOctetString(263, session, mandatory)
+                    .putOctetString(264, host, mandatory)
+                    .putOctetString(296, realm, mandatory)
+                    .putOctetString(283, destinationRealm, mandatory)
+                    .putUnsigned32(258, 4, mandatory)
+                    .putUnsigned32(416, 2, mandatory)
+                    .putUnsigned32(415, ++number, mandatory)
+                    .beginGrouped(446, mandatory)
+                        .putUnsigned64(421, 1048576, mandatory)
+                        .putUnsigned32(417, 7, mandatory)
+                    .endGrouped()
+                .endMessage();
+
+            benchmark::DoNotOptimize(encoder.size());
+            benchmark::ClobberMemory();
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+
+    static void NestedGrouped(benchmark::State& state)
+    {
+        uint8_t buffer[4096];
+
+        for (auto _ : state)
+        {
+            Diameter::Encoder encoder(buffer, sizeof(buffer));
+
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                encoder.beginGrouped(456, mandatory);
+            }
+
+            encoder.putUnsigned64(421, 1, mandatory);
+
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                encoder.endGrouped();
+            }
+
+            benchmark::DoNotOptimize(encoder.size());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_NS(Encoder::EncodeCCR);
+BENCHMARK_NS(Encoder::NestedGrouped)
+    ->DenseRange(1, Diameter::Encoder::MaxDepth, 5)
+    ->Complexity();
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/HeaderPatcher.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    static const ByteArray binaryDPR = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+    );
+}
+
+namespace HeaderPatcher
+{
+    static void PatchRelay(benchmark::State& state)
+    {
+        auto buffer = binaryDPR;
+
+        uint32_t hopByHop = 0;
+
+        for (auto _ : state)
+        {
+            Diameter::HeaderPatcher(buffer)
+                .setHBHIdentifier(++hopByHop)
+                .setFlag(Diameter::Packet::Header::Flags::Bits::ReTransmitted, true);
+
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+
+    static void DecodeEncodeRelay(benchmark::State& state)
+    {
+        auto buffer = binaryDPR;
+
+        uint32_t hopByHop = 0;
+
+        for (auto _ : state)
+        {
+            Diameter::Packet packet(buffer);
+
+            packet.header().setHBHIdentifier(++hopByHop);
+            packet.header().commandFlags().setFlag(Diameter::Packet::Header::Flags::Bits::ReTransmitted, true);
+
+            buffer.clear();
+            packet.deploy(buffer);
+
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+}
+
+BENCHMARK_NS(HeaderPatcher::PatchRelay);
+BENCHMARK_NS(HeaderPatcher::DecodeEncodeRelay);
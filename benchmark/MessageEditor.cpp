@@ -0,0 +1,192 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/MessageEditor.hpp>
+#include <Diameter/Packet.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    static const ByteArray binaryDPR = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+    );
+
+    Diameter::AVP routeRecord()
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(282)
+            )
+            .setData(
+                Diameter::AVP::Data()
+                    .setOctetString(ByteArray::fromASCII("relay.example.com"))
+            )
+            .updateLength();
+    }
+
+    Diameter::AVP leaf(uint32_t code, const char* value)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+            )
+            .setData(
+                Diameter::AVP::Data()
+                    .setOctetString(ByteArray::fromASCII(value))
+            )
+            .updateLength();
+    }
+
+    Diameter::AVP subscriptionId(const char* data)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(443)
+            )
+            .setData(
+                Diameter::AVP::Data()
+                    .addAVP(leaf(450, "type"))
+                    .addAVP(leaf(444, data))
+            )
+            .updateLength();
+    }
+
+    ByteArray subscriber()
+    {
+        return Diameter::Packet()
+            .addAVP(leaf(263, "session;1"))
+            .addAVP(subscriptionId("123"))
+            .addAVP(leaf(296, "realm"))
+            .updateLength()
+            .deploy();
+    }
+}
+
+namespace MessageEditor
+{
+    static void AppendRouteRecord(benchmark::State& state)
+    {
+        auto avp = routeRecord();
+
+        ByteArray message(binaryDPR.size() + avp.calculateLength(true));
+
+        for (auto _ : state)
+        {
+            message.assign(binaryDPR.begin(), binaryDPR.end());
+
+            Diameter::MessageEditor(message)
+                .appendAVP(avp);
+
+            benchmark::DoNotOptimize(message.data());
+        }
+    }
+
+    static void AppendRouteRecordDecodeEncode(benchmark::State& state)
+    {
+        auto avp = routeRecord();
+
+        ByteArray message(binaryDPR.size() + avp.calculateLength(true));
+
+        for (auto _ : state)
+        {
+            message.assign(binaryDPR.begin(), binaryDPR.end());
+
+            Diameter::Packet packet(message);
+
+            packet
+                .addAVP(avp)
+                .updateLength();
+
+            message.clear();
+            packet.deploy(message, false);
+
+            benchmark::DoNotOptimize(message.data());
+        }
+    }
+
+    static void RemoveAll(benchmark::State& state)
+    {
+        ByteArray message(binaryDPR.size());
+
+        for (auto _ : state)
+        {
+            message.assign(binaryDPR.begin(), binaryDPR.end());
+
+            benchmark::DoNotOptimize(
+                Diameter::MessageEditor(message)
+                    .removeAll(273)
+            );
+        }
+    }
+
+    static void SetNestedValue(benchmark::State& state)
+    {
+        auto binary = subscriber();
+        auto value = ByteArray::fromASCII("79161234567");
+
+        auto path = Diameter::AVPPath()
+            .child(443)
+            .child(444);
+
+        ByteArray message(binary.size() + value.size());
+
+        for (auto _ : state)
+        {
+            message.assign(binary.begin(), binary.end());
+
+            Diameter::MessageEditor(message)
+                .setValue(path, value);
+
+            benchmark::DoNotOptimize(message.data());
+        }
+    }
+
+    static void SetNestedValueDecodeEncode(benchmark::State& state)
+    {
+        auto binary = subscriber();
+        auto value = ByteArray::fromASCII("79161234567");
+
+        ByteArray message(binary.size() + value.size());
+
+        for (auto _ : state)
+        {
+            message.assign(binary.begin(), binary.end());
+
+            Diameter::Packet packet(message);
+
+            auto children = packet.avp(1).data().toAVPs();
+
+            children[1]
+                .setData(Diameter::AVP::Data().setOctetString(value))
+                .updateLength();
+
+            auto group = packet.avp(1);
+
+            group
+                .setData(Diameter::AVP::Data().addAVP(children.begin(), children.end()))
+                .updateLength();
+
+            packet
+                .replaceAVP(group, 1)
+                .updateLength();
+
+            message.clear();
+            packet.deploy(message, false);
+
+            benchmark::DoNotOptimize(message.data());
+        }
+    }
+}
+
+BENCHMARK_NS(MessageEditor::AppendRouteRecord);
+BENCHMARK_NS(MessageEditor::AppendRouteRecordDecodeEncode);
+BENCHMARK_NS(MessageEditor::RemoveAll);
+BENCHMARK_NS(MessageEditor::SetNestedValue);
+BENCHMARK_NS(MessageEditor::SetNestedValueDecodeEncode);
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/MessageTemplate.hpp>
+#include <Diameter/Packet.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
+
+namespace {
+    Diameter::AVP octetString(uint32_t code, const ByteArray& value)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+                    .setFlags(
+                        Diameter::AVP::Header::Flags()
+                            .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true)
+                    )
+            )
+            .setData(
+                Diameter::AVP::Data()
+                    .setOctetString(value)
+            )
+            .updateLength();
+    }
+
+    Diameter::AVP unsigned32(uint32_t code, uint32_t value)
+    {
+        return octetString(code, ByteArray())
+            .setData(
+                Diameter::AVP::Data()
+                    .setUnsigned32(value)
+            )
+            .updateLength();
+    }
+
+    Diameter::Packet creditControl(const ByteArray& sessionId,
+                                   uint32_t requestNumber,
+                                   const ByteArray& totalOctets)
+    {
+        return Diameter::Packet()
+            .setHeader(
+                Diameter::Packet::Header()
+                    .setCommandFlags(
+                        Diameter::Packet::Header::Flags()
+                            .setFlag(Diameter::Packet::Header::Flags::Bits::Request, true)
+                    )
+                    .setCommandCode(272)
+                    .setApplicationId(4)
+            )
+            .addAVP(octetString(263, sessionId))
+            .addAVP(octetString(264, ByteArray::fromASCII("client.example.com")))
+            .addAVP(octetString(296, ByteArray::fromASCII("example.com")))
+            .addAVP(octetString(283, ByteArray::fromASCII("server.example.com")))
+            .addAVP(unsigned32(258, 4))
+            .addAVP(unsigned32(416, 2))
+            .addAVP(unsigned32(415, requestNumber))
+            .addAVP(
+                octetString(446, ByteArray())
+                    .setData(
+                        Diameter::AVP::Data()
+                            .addAVP(octetString(421, totalOctets))
+                            .addAVP(unsigned32(417, 7))
+                    )
+                    .updateLength()
+            )
+            .updateLength();
+    }
+}
+
+namespace MessageTemplate
+{
+    static void StampCCR(benchmark::State& state)
+    {
+        Diameter::MessageTemplate ccr(creditControl(ByteArray::fromASCII("session"), 0, ByteArray()));
+
+        auto sessionId = ccr.addSlot(Diameter::AVPPath().child(263));
+        auto requestNumber = ccr.addSlot(Diameter::AVPPath().child(415));
+        auto totalOctets = ccr.addSlot(Diameter::AVPPath().child(446).child(421));
+
+        auto session = ByteArray::fromASCII("client.example.com;1234;5678");
+        auto octets = ByteArray::fromASCII("1048576");
+
+        std::vector<Diameter::MessageTemplate::SlotValue> values(ccr.numberOfSlots());
+
+        values[sessionId] = Diameter::MessageTemplate::SlotValue(session);
+        values[totalOctets] = Diameter::MessageTemplate::SlotValue(octets);
+        values[requestNumber] = Diameter::MessageTemplate::SlotValue::fromUnsigned32(0);
+
+        ByteArray message;
+        message.resize(ccr.calculateLength(values));
+
+        uint32_t number = 0;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            values[requestNumber] = Diameter::MessageTemplate::SlotValue::fromUnsigned32(++number);
+
+            benchmark::DoNotOptimize(ccr.stamp(values, message.data()));
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+
+    static void BuildCCR(benchmark::State& state)
+    {
+        auto session = ByteArray::fromASCII("client.example.com;1234;5678");
+        auto octets = ByteArray::fromASCII("1048576");
+
+        uint32_t number = 0;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(creditControl(session, ++number, octets).deploy());
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+}
+
+BENCHMARK_NS(MessageTemplate::StampCCR);
+BENCHMARK_NS(MessageTemplate::BuildCCR);
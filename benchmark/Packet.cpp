@@ -1,8 +1,11 @@
 #include <benchmark/benchmark.h>
 #include <Diameter/Packet.hpp>
+#include <Diameter/InterestSet.hpp>
+#include <Diameter/SegmentList.hpp>
 #include <iostream>
 #include <cstdint>
 #include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
 
 namespace {
     Diameter::AVP generateAVP(uint32_t size)
@@ -19,6 +22,15 @@ namespace {
             .updateLength();
     }
     
+    Diameter::Packet generateLargePacket(uint32_t payloadSize)
+    {
+        return Diameter::Packet()
+            .addAVP(generateAVP(16))
+            .addAVP(generateAVP(payloadSize))
+            .addAVP(generateAVP(16))
+            .updateLength();
+    }
+
     static const ByteArray binaryCER = ByteArray::fromHex(
         "010001b880000101000000007ddf9e97"
         "c15f0a0a000001084000000f64726532"
@@ -169,6 +181,29 @@ namespace Packet
         }
     }
 
+    static void HeaderPeek(benchmark::State& state)
+    {
+        Diameter::Packet::Header header;
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                Diameter::Packet::Header::peek(binaryCER.data(), binaryCER.size(), header)
+            );
+            benchmark::DoNotOptimize(header);
+        }
+    }
+
+    static void HeaderFromByteArray(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                Diameter::Packet::Header(binaryCER.mid(0, Diameter::Packet::Header::Size))
+            );
+        }
+    }
+
     static void AddAVP(benchmark::State& state)
     {
         auto avp = generateAVP(
@@ -244,6 +279,118 @@ namespace Packet
         }
     }
     
+    static void DeployCER(benchmark::State& state)
+    {
+        Diameter::Packet packet(binaryCER);
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(packet.deploy(false));
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+
+    static void DeployCERChecked(benchmark::State& state)
+    {
+        Diameter::Packet packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(packet.deploy());
+        }
+    }
+
+    static void UpdateLength(benchmark::State& state)
+    {
+        Diameter::Packet packet;
+
+        auto avp = generateAVP(32);
+
+        for (int i = 0; i < state.range(0); ++i)
+        {
+            packet.addAVP(avp);
+        }
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(packet.updateLength());
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    static void DeployCERMemoized(benchmark::State& state)
+    {
+        Diameter::Packet packet(binaryCER, Diameter::Packet::ParseMode::Memoized);
+
+        ByteArray array(binaryCER.size());
+
+        for (auto _ : state)
+        {
+            array.clear();
+            packet.deploy(array, false);
+        }
+    }
+
+    static void DeployCERAlreadyAllocated(benchmark::State& state)
+    {
+        Diameter::Packet packet(binaryCER);
+
+        ByteArray array(binaryCER.size());
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            array.clear();
+            packet.deploy(array, false);
+        }
+
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+
+    static void DeployLargeContiguous(benchmark::State& state)
+    {
+        auto packet = generateLargePacket(static_cast<uint32_t>(state.range(0)));
+
+        ByteArray array(packet.calculateLength());
+
+        for (auto _ : state)
+        {
+            array.clear();
+            packet.deploy(array, false);
+
+            benchmark::DoNotOptimize(array.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    static void DeployLargeSegments(benchmark::State& state)
+    {
+        auto packet = generateLargePacket(static_cast<uint32_t>(state.range(0)));
+
+        Diameter::SegmentList segments;
+
+        for (auto _ : state)
+        {
+            packet.deploy(segments, false);
+
+            benchmark::DoNotOptimize(segments.segments().data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
     static void BuildingCER(benchmark::State& state)
     {
         std::vector<uint32_t> values = {
@@ -487,6 +634,93 @@ namespace Packet
             benchmark::DoNotOptimize(Diameter::Packet(binaryCER));
         }
     }
+
+    static void ParsingCERLazy(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Diameter::Packet(binaryCER, Diameter::Packet::ParseMode::Lazy));
+        }
+    }
+
+    static void ParsingCERLazyFewAVPs(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Diameter::Packet packet(binaryCER, Diameter::Packet::ParseMode::Lazy);
+
+            benchmark::DoNotOptimize(packet.avp(0));
+            benchmark::DoNotOptimize(packet.avp(21));
+            benchmark::DoNotOptimize(packet.avp(27));
+        }
+    }
+
+    static void ParsingCERMemoized(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Diameter::Packet(binaryCER, Diameter::Packet::ParseMode::Memoized));
+        }
+    }
+
+    static void ParsingCERInterest(benchmark::State& state)
+    {
+        // Routing AVPs: Destination-Realm, Destination-Host,
+        // Session-Id, Route-Record, Origin-Host
+        Diameter::InterestSet interests;
+
+        interests
+            .add(283)
+            .add(293)
+            .add(263)
+            .add(282)
+            .add(264);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Diameter::Packet(binaryCER, interests));
+        }
+    }
+
+    // Codes of typical routing lookups. Last one is absent.
+    static const uint32_t lookupCodes[] = {264, 296, 258, 266, 269, 263};
+
+    static void FindCER(benchmark::State& state)
+    {
+        Diameter::Packet packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            for (auto code : lookupCodes)
+            {
+                benchmark::DoNotOptimize(packet.find(code));
+            }
+        }
+    }
+
+    static void FindCERLinear(benchmark::State& state)
+    {
+        Diameter::Packet packet(binaryCER);
+
+        for (auto _ : state)
+        {
+            for (auto code : lookupCodes)
+            {
+                uint32_t found = Diameter::Packet::NoAVP;
+
+                for (uint32_t i = 0; i < packet.numberOfAVPs(); ++i)
+                {
+                    if (packet.avp(i).header().avpCode() == code)
+                    {
+                        found = i;
+                        break;
+                    }
+                }
+
+                benchmark::DoNotOptimize(found);
+            }
+        }
+    }
 }
 
 BENCHMARK_NS(Packet::DefaultConstruction);
@@ -503,6 +737,8 @@ BENCHMARK_NS(Packet::MoveWithData)
 BENCHMARK_NS(Packet::SetHeader);
 BENCHMARK_NS(Packet::SetHeaderReference);
 BENCHMARK_NS(Packet::Header);
+BENCHMARK_NS(Packet::HeaderPeek);
+BENCHMARK_NS(Packet::HeaderFromByteArray);
 BENCHMARK_NS(Packet::AddAVP)
     ->Range(1, 1 << 20)
     ->Complexity();
@@ -516,5 +752,22 @@ BENCHMARK_NS(Packet::ReplacePreLastAVP)
     ->Complexity();
 
 BENCHMARK_NS(Packet::IsValidCER);
+BENCHMARK_NS(Packet::DeployCER);
+BENCHMARK_NS(Packet::DeployCERAlreadyAllocated);
+BENCHMARK_NS(Packet::DeployCERMemoized);
+BENCHMARK_NS(Packet::DeployCERChecked);
+BENCHMARK_NS(Packet::UpdateLength)
+    ->Range(4, 1 << 16)
+    ->Complexity();
+BENCHMARK_NS(Packet::DeployLargeContiguous)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_NS(Packet::DeployLargeSegments)
+    ->Range(1 << 10, 1 << 16);
 BENCHMARK_NS(Packet::BuildingCER);
-BENCHMARK_NS(Packet::ParsingCER);
\ No newline at end of file
+BENCHMARK_NS(Packet::ParsingCER);
+BENCHMARK_NS(Packet::ParsingCERLazy);
+BENCHMARK_NS(Packet::ParsingCERLazyFewAVPs);
+BENCHMARK_NS(Packet::ParsingCERMemoized);
+BENCHMARK_NS(Packet::ParsingCERInterest);
+BENCHMARK_NS(Packet::FindCER);
+BENCHMARK_NS(Packet::FindCERLinear);
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/PacketPool.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+#include "bench_extend/AllocationCounter.hpp"
+
+namespace {
+    const ByteArray answer = ByteArray::fromHex(
+            "010000648000011a000000007ddf9367"
+            "c15ecb1200000108400000206e312e63"
+            "7573746f6d2e7463702e736572766572"
+            "2e636f6d000001114000000c00000000"
+            "0000012840000021637573746f6d2e74"
+            "657374696e672e7365727665722e636f"
+            "6d000000"
+    );
+
+    void countAllocations(benchmark::State& state, uint64_t allocations)
+    {
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(AllocationCounter::allocations() - allocations),
+            benchmark::Counter::kAvgIterations
+        );
+    }
+}
+
+namespace PacketPool
+{
+    static void ParseNewPacket(benchmark::State& state)
+    {
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            Diameter::Packet packet;
+
+            Diameter::Packet::tryParse(answer.data(), answer.size(), packet);
+
+            benchmark::DoNotOptimize(packet.find(264));
+        }
+
+        countAllocations(state, allocations);
+    }
+
+    static void ParseIntoSamePacket(benchmark::State& state)
+    {
+        Diameter::Packet packet;
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            Diameter::Packet::tryParse(answer.data(), answer.size(), packet);
+
+            benchmark::DoNotOptimize(packet.find(264));
+        }
+
+        countAllocations(state, allocations);
+    }
+
+    static void ParsePooledPacket(benchmark::State& state)
+    {
+        auto& pool = Diameter::PacketPool::local();
+
+        auto allocations = AllocationCounter::allocations();
+
+        for (auto _ : state)
+        {
+            auto packet = pool.acquire();
+
+            Diameter::Packet::tryParse(answer.data(), answer.size(), packet);
+
+            benchmark::DoNotOptimize(packet.find(264));
+
+            pool.release(std::move(packet));
+        }
+
+        countAllocations(state, allocations);
+    }
+}
+
+BENCHMARK_NS(PacketPool::ParseNewPacket);
+BENCHMARK_NS(PacketPool::ParseIntoSamePacket);
+BENCHMARK_NS(PacketPool::ParsePooledPacket);
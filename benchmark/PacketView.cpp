@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/PacketView.hpp>
+#include <iostream>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    static const ByteArray binaryCER = ByteArray::fromHex(
+        "010001b880000101000000007ddf9e97"
+        "c15f0a0a000001084000000f64726532"
+        "30313700000001024000000c00000000"
+        "000001024000000c0000000400000102"
+        "4000000c01000016000001024000000c"
+        "01000014000001024000000c01000032"
+        "000001024000000c0100002300000102"
+        "4000000c01000024000001024000000c"
+        "01000033000001024000000c01000001"
+        "000001024000000c0100000000000102"
+        "4000000c01000056000001024000000c"
+        "01000057000001024000000c0000000a"
+        "000001024000000c0100000600000102"
+        "4000000c00000003000001024000000c"
+        "01000066000001024000000c01000038"
+        "000001024000000c0100003000000102"
+        "4000000c01000031000001024000000c"
+        "0000d90500000128400000256d6e6330"
+        "30322e6d63633235302e336770706e65"
+        "74776f726b2e6f72670000000000010d"
+        "000000144954532d4469616d65746572"
+        "0000012b4000000c000000010000012b"
+        "4000000c00000000000001014000000e"
+        "0001c0a806610000000001014000000e"
+        "0001c0a8066100000000010a4000000c"
+        "000000000000010b0000000c00000001"
+        "000001094000000c000028af00000103"
+        "4000000c00000003"
+    );
+}
+
+namespace PacketView
+{
+    static void ParsingCER(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Diameter::PacketView(binaryCER));
+        }
+    }
+
+    static void IterateCER(benchmark::State& state)
+    {
+        Diameter::PacketView view(binaryCER);
+
+        for (auto _ : state)
+        {
+            for (auto avp : view)
+            {
+                benchmark::DoNotOptimize(avp.avpCode());
+            }
+        }
+    }
+
+    static void IsValidCER(benchmark::State& state)
+    {
+        Diameter::PacketView view(binaryCER);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(view.isValid());
+        }
+    }
+
+    static void ToPacketCER(benchmark::State& state)
+    {
+        Diameter::PacketView view(binaryCER);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(view.toPacket());
+        }
+    }
+}
+
+BENCHMARK_NS(PacketView::ParsingCER);
+BENCHMARK_NS(PacketView::IterateCER);
+BENCHMARK_NS(PacketView::IsValidCER);
+BENCHMARK_NS(PacketView::ToPacketCER);
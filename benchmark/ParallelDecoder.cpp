@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/ParallelDecoder.hpp>
+#include <thread>
+#include <algorithm>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    static const ByteArray binaryDPR = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+    );
+
+    const int64_t NumberOfMessages = 1 << 14;
+
+    int64_t maximumThreads()
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+namespace ParallelDecoder
+{
+    static void Decode(benchmark::State& state)
+    {
+        std::vector<ByteArray> messages(NumberOfMessages, binaryDPR);
+
+        Diameter::ParallelDecoder decoder(static_cast<uint32_t>(state.range(0)));
+
+        std::vector<Diameter::Packet> packets;
+        std::vector<Diameter::ParseResult> results;
+
+        for (auto _ : state)
+        {
+            decoder.decode(messages, packets, results);
+
+            benchmark::DoNotOptimize(packets.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * NumberOfMessages);
+    }
+
+    static void DecodeSingleThread(benchmark::State& state)
+    {
+        std::vector<ByteArray> messages(NumberOfMessages, binaryDPR);
+
+        std::vector<Diameter::Packet> packets;
+
+        for (auto _ : state)
+        {
+            packets.clear();
+
+            for (auto& message : messages)
+            {
+                packets.emplace_back(message);
+            }
+
+            benchmark::DoNotOptimize(packets.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * NumberOfMessages);
+    }
+}
+
+BENCHMARK_NS(ParallelDecoder::Decode)
+    ->DenseRange(1, maximumThreads())
+    ->UseRealTime();
+BENCHMARK_NS(ParallelDecoder::DecodeSingleThread)
+    ->UseRealTime();
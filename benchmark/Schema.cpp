@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/Schema.hpp>
+#include <Diameter/Packet.hpp>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    const Diameter::Packet::Header::Flags::Type Request =
+        static_cast<Diameter::Packet::Header::Flags::Type>(Diameter::Packet::Header::Flags::Bits::Request);
+
+    // Device-Watchdog-Request
+    using DWR = Diameter::Schema::Message<
+        280,
+        Request,
+        0,
+        Diameter::Schema::Field<264, Diameter::Schema::Type::OctetString>, // Origin-Host
+        Diameter::Schema::Field<296, Diameter::Schema::Type::OctetString>, // Origin-Realm
+        Diameter::Schema::Field<278, Diameter::Schema::Type::Unsigned32>   // Origin-State-Id
+    >;
+
+    Diameter::AVP avp(uint32_t code, const Diameter::AVP::Data& data)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+                    .setFlags(
+                        Diameter::AVP::Header::Flags()
+                            .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true)
+                    )
+            )
+            .setData(data)
+            .updateLength();
+    }
+
+    Diameter::Packet watchdog(const ByteArray& host, const ByteArray& realm, uint32_t stateId)
+    {
+        return Diameter::Packet()
+            .setHeader(
+                Diameter::Packet::Header()
+                    .setCommandFlags(Diameter::Packet::Header::Flags(Request))
+                    .setCommandCode(280)
+            )
+            .addAVP(avp(264, Diameter::AVP::Data().setOctetString(host)))
+            .addAVP(avp(296, Diameter::AVP::Data().setOctetString(realm)))
+            .addAVP(avp(278, Diameter::AVP::Data().setUnsigned32(stateId)))
+            .updateLength();
+    }
+}
+
+namespace Schema
+{
+    static void EncodeDWR(benchmark::State& state)
+    {
+        auto host = ByteArray::fromASCII("client.example.com");
+        auto realm = ByteArray::fromASCII("example.com");
+
+        DWR::Values values(host, realm, 1u);
+
+        ByteArray message;
+        message.resize(DWR::calculateLength(values));
+
+        uint32_t identifier = 0;
+
+        for (auto _ : state)
+        {
+            ++identifier;
+
+            benchmark::DoNotOptimize(DWR::encode(values, identifier, identifier, message.data()));
+        }
+    }
+
+    static void BuildDWR(benchmark::State& state)
+    {
+        auto host = ByteArray::fromASCII("client.example.com");
+        auto realm = ByteArray::fromASCII("example.com");
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(watchdog(host, realm, 1).deploy());
+        }
+    }
+
+    static void DecodeDWR(benchmark::State& state)
+    {
+        auto message = watchdog(
+            ByteArray::fromASCII("client.example.com"),
+            ByteArray::fromASCII("example.com"),
+            1
+        ).deploy();
+
+        DWR::Values values;
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(DWR::decode(message.data(), message.size(), values));
+        }
+    }
+
+    static void ParseDWR(benchmark::State& state)
+    {
+        auto message = watchdog(
+            ByteArray::fromASCII("client.example.com"),
+            ByteArray::fromASCII("example.com"),
+            1
+        ).deploy();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Diameter::Packet(message));
+        }
+    }
+}
+
+BENCHMARK_NS(Schema::EncodeDWR);
+BENCHMARK_NS(Schema::BuildDWR);
+BENCHMARK_NS(Schema::DecodeDWR);
+BENCHMARK_NS(Schema::ParseDWR);
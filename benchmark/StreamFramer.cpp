@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+#include <Diameter/StreamFramer.hpp>
+#include <Diameter/Packet.hpp>
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include "bench_extend/NamespaceRegistrator.hpp"
+
+namespace {
+    static const ByteArray binaryDPR = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+    );
+}
+
+namespace StreamFramer
+{
+    static void Framing(benchmark::State& state)
+    {
+        ByteArray stream;
+
+        for (int i = 0; i < 1024; ++i)
+        {
+            stream.append(binaryDPR);
+        }
+
+        auto chunkSize = static_cast<uint32_t>(state.range(0));
+
+        Diameter::StreamFramer framer(4096);
+
+        for (auto _ : state)
+        {
+            for (uint32_t offset = 0; offset < stream.size(); offset += chunkSize)
+            {
+                framer.feed(
+                    stream.data() + offset,
+                    std::min<uint32_t>(chunkSize, stream.size() - offset)
+                );
+
+                const uint8_t* message;
+                uint32_t size;
+
+                while (framer.next(message, size) == Diameter::StreamFramer::Status::Message)
+                {
+                    benchmark::DoNotOptimize(message);
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * stream.size());
+    }
+}
+
+BENCHMARK_NS(StreamFramer::Framing)
+    ->RangeMultiplier(4)
+    ->Range(64, 1 << 16);
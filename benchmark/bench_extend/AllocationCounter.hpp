@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Global operator new is replaced in benchmark
+ * binary to count heap allocations.
+ */
+namespace AllocationCounter
+{
+    /**
+     * @brief Function for getting number of heap
+     * allocations since program start.
+     * @return Number of allocations.
+     */
+    uint64_t allocations();
+}
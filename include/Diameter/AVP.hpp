@@ -7,6 +7,9 @@
 #include <cstdint>
 #include <ByteArray.hpp>
 #include <vector>
+#include <memory>
+#include "Arena.hpp"
+#include "ParseResult.hpp"
 
 namespace Diameter
 {
@@ -53,24 +56,40 @@ namespace Diameter
                 /**
                  * @brief Constructor.
                  */
-                Flags();
+                constexpr Flags() :
+                    m_bits(0)
+                {
+
+                }
 
                 /**
                  * @brief Parsing constructor.
                  * @param array Flags value.
                  */
-                explicit Flags(Type array);
+                constexpr explicit Flags(Type array) :
+                    m_bits(array)
+                {
+
+                }
 
                 /**
                  * @brief Move constructor.
                  */
-                Flags(Flags&& rhs) noexcept;
+                constexpr Flags(Flags&& rhs) noexcept :
+                    m_bits(rhs.m_bits)
+                {
+
+                }
 
                 /**
                  * @brief Copy constructor.
                  * @param rhs
                  */
-                Flags(const Flags& rhs);
+                constexpr Flags(const Flags& rhs) :
+                    m_bits(rhs.m_bits)
+                {
+
+                }
 
                 /**
                  * @brief Method for setting bit value.
@@ -85,19 +104,29 @@ namespace Diameter
                  * @param bit Bit.
                  * @return Value.
                  */
-                bool isSet(Bits bit) const;
+                constexpr bool isSet(Bits bit) const
+                {
+                    return (m_bits & static_cast<Type>(bit)) == static_cast<Type>(bit);
+                }
 
                 /**
                  * @brief Method for getting flags serialized.
                  * @return Serialized.
                  */
-                Type deploy() const;
+                constexpr Type deploy() const
+                {
+                    return m_bits;
+                }
 
                 /**
                  * @brief Method for checking are flags valid.
+                 * Lower 5 bits are reserved and has to be 0.
                  * @return Flags validness.
                  */
-                bool isValid() const;
+                constexpr bool isValid() const
+                {
+                    return (m_bits & 0x1F) == 0; // 0b00011111
+                }
 
                 /**
                  * @brief Move operator.
@@ -245,6 +274,14 @@ namespace Diameter
              */
             void deploy(ByteArray& byteArray) const;
 
+            /**
+             * @brief Method for deploying AVP header to
+             * raw memory. calculateSize() bytes are written.
+             * @param data Pointer to destination.
+             * @return Pointer past written bytes.
+             */
+            uint8_t* deploy(uint8_t* data) const;
+
             /**
              * @brief Move operator.
              * @param rhs Moved object.
@@ -271,6 +308,19 @@ namespace Diameter
          * There is no Float32 and Float64 types, because
          * C++ standard does not defines `float` and `double`
          * implementation.
+         *
+         * AVPs, added to grouped data, are kept as objects
+         * after raw value bytes. They are serialized only
+         * when data itself is deployed or flattened, so
+         * nested groups are serialized once. Added AVPs are shared between
+         * copies of data until one of copies is changed.
+         *
+         * Values up to InlineSize bytes (integers, short
+         * strings) are kept inside of object, so they
+         * don't allocate. Bigger values are kept in heap
+         * or in arena, if data was created with arena.
+         * Added AVPs of such data are kept in arena too.
+         * Copies of data do not use arena.
          */
         class Data
         {
@@ -278,11 +328,21 @@ namespace Diameter
 
             using AVPContainer = std::vector<AVP>;
 
+            const static uint32_t InlineSize = 24; //< Maximum size of value, kept inside of object
+
             /**
              * @brief Default constructor.
              */
             Data();
 
+            /**
+             * @brief Constructor. Values, that don't fit
+             * inline, and added AVPs are allocated from arena.
+             * Data has to be destroyed before arena reset.
+             * @param arena Arena.
+             */
+            explicit Data(Arena& arena);
+
             /**
              * @brief Parsing constructor.
              * @param array Byte array.
@@ -290,6 +350,21 @@ namespace Diameter
              */
             explicit Data(const ByteArray& byteArray);
 
+            /**
+             * @brief Parsing constructor.
+             * Byte array is moved into data.
+             * @param byteArray Byte array.
+             */
+            explicit Data(ByteArray&& byteArray);
+
+            /**
+             * @brief Parsing constructor.
+             * Value is copied from raw memory.
+             * @param data Pointer to first byte of value.
+             * @param size Value size in bytes.
+             */
+            Data(const uint8_t* data, std::size_t size);
+
             /**
              * @brief Move constructor.
              */
@@ -308,6 +383,15 @@ namespace Diameter
              */
             Data& setOctetString(const ByteArray &value);
 
+            /**
+             * @brief Method for setting raw memory as data.
+             * Heap buffer of data is reused, if it's big enough.
+             * @param data Pointer to first byte of value.
+             * @param size Value size in bytes.
+             * @return Reference to constructor.
+             */
+            Data& setOctetString(const uint8_t* data, std::size_t size);
+
             /**
              * @brief Method for translating data to octet string.
              * @return Массив байт.
@@ -390,6 +474,17 @@ namespace Diameter
              */
             AVPContainer toAVPs() const;
 
+            /**
+             * @brief Exception-free method for getting avps
+             * from data value. Whole value is validated
+             * before container is touched.
+             * @param container Container, that AVPs will
+             * be appended to. It's untouched on failure.
+             * @return Parsing result. Offset is relative
+             * to value beginning.
+             */
+            ParseResult tryToAVPs(AVPContainer& container) const;
+
             /**
              * @brief Method for appending AVP
              * to data.
@@ -398,6 +493,14 @@ namespace Diameter
              */
             Data& addAVP(const AVP& avp);
 
+            /**
+             * @brief Method for appending AVP
+             * to data. AVP is moved into data.
+             * @param avp AVP object.
+             * @return Reference to constructor.
+             */
+            Data& addAVP(AVP&& avp);
+
             /**
              * @brief Method for adding AVPs from range
              * @tparam InputIterator Input iterator type.
@@ -422,6 +525,23 @@ namespace Diameter
              */
             uint32_t size() const;
 
+            /**
+             * @brief Method for getting pointer to value
+             * bytes without copying. It's valid until data
+             * is modified or moved. Added AVPs are not
+             * contiguous with value, so nullptr is returned
+             * until flatten() is called.
+             * @return Pointer to first byte or nullptr.
+             */
+            const uint8_t* data() const;
+
+            /**
+             * @brief Method for serializing added AVPs
+             * into value bytes, so data() is contiguous.
+             * @return Reference to constructor.
+             */
+            Data& flatten();
+
             /**
              * @brief Method for AVP data validating.
              * @return Is valid.
@@ -441,6 +561,14 @@ namespace Diameter
              */
             void deploy(ByteArray& byteArray) const;
 
+            /**
+             * @brief Method for deploying Data to raw
+             * memory. size() bytes are written.
+             * @param data Pointer to destination.
+             * @return Pointer past written bytes.
+             */
+            uint8_t* deploy(uint8_t* data) const;
+
             /**
              * @brief Move operator.
              * @param rhs Moved object.
@@ -456,7 +584,81 @@ namespace Diameter
             Data& operator=(const Data& rhs);
 
         private:
+
+            // Added AVPs, that may take memory from arena
+            using Children = std::vector<AVP, ArenaAllocator<AVP>>;
+
+            /**
+             * @brief Method for replacing value bytes.
+             * Added AVPs are dropped.
+             * @param data Pointer to first byte of value.
+             * @param size Value size in bytes.
+             */
+            void assign(const uint8_t* data, std::size_t size);
+
+            /**
+             * @brief Method for getting value bytes
+             * without added AVPs.
+             * @return Pointer to first byte.
+             */
+            const uint8_t* valueData() const;
+
+            /**
+             * @brief Method for getting size of value
+             * bytes without added AVPs.
+             * @return Size in bytes.
+             */
+            uint32_t valueSize() const;
+
+            /**
+             * @brief Method for getting contiguous value
+             * without changing data. Added AVPs are
+             * serialized into buffer.
+             * @param buffer Buffer of size() bytes. It's
+             * used only if there are added AVPs.
+             * @return Pointer to first byte.
+             */
+            const uint8_t* read(uint8_t* buffer) const;
+
+            /**
+             * @brief Method for getting buffer for value,
+             * that does not fit inline. Arena buffer is
+             * reused if it's big enough.
+             * @param size Value size in bytes.
+             * @return Pointer to buffer.
+             */
+            uint8_t* allocateValue(std::size_t size);
+
+            /**
+             * @brief Method for getting added AVPs for
+             * appending. Shared AVPs are copied first.
+             * @return Added AVPs.
+             */
+            Children& ownChildren();
+
+            /**
+             * @brief Method for taking added AVPs of other
+             * data. They are shared if they don't depend on
+             * other arena, and copied otherwise.
+             * @param other Other data.
+             */
+            void shareChildren(const Data& other);
+
+            // Raw value bytes, followed by added AVPs.
+            // AVPs are flattened into bytes only by
+            // flatten(). Value is kept inline if it fits,
+            // arena or heap value is used otherwise.
+            uint8_t m_inline[InlineSize];
+            uint32_t m_valueSize;
             ByteArray m_value;
+            std::shared_ptr<Children> m_children;
+            uint32_t m_childrenSize; //< Padded size of added AVPs
+
+            // Arena value. It's used instead of m_value
+            // if data has arena.
+            Arena* m_arena;
+            uint8_t* m_arenaValue;
+            uint32_t m_arenaCapacity;
         };
 
         /**
@@ -464,6 +666,13 @@ namespace Diameter
          */
         AVP();
 
+        /**
+         * @brief Constructor. Value of AVP is allocated
+         * from arena, as described for Data.
+         * @param arena Arena.
+         */
+        explicit AVP(Arena& arena);
+
         /**
          * @brief Parsing constructor.
          * If can't parse - throw std::invalid_argument
@@ -472,6 +681,16 @@ namespace Diameter
          */
         explicit AVP(const ByteArray &array);
 
+        /**
+         * @brief Exception-free parsing method.
+         * Padding after AVP is optional.
+         * @param data Pointer to first byte of AVP.
+         * @param size Number of available bytes.
+         * @param avp Result AVP. It's untouched on failure.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult tryParse(const uint8_t* data, std::size_t size, AVP& avp);
+
         /**
          * @brief Move constructor.
          */
@@ -509,11 +728,20 @@ namespace Diameter
          */
         AVP& setData(const Data& data);
 
+        /**
+         * @brief Method for setting AVPs data.
+         * Data is moved into AVP.
+         * @param data Data.
+         * @return Reference to constructor.
+         */
+        AVP& setData(Data&& data);
+
         /**
          * @brief Method for getting AVPs data.
+         * Value is not copied.
          * @return Data.
          */
-        Data data() const;
+        const Data& data() const;
 
         /**
          * @brief Method for getting AVPs data.
@@ -568,9 +796,45 @@ namespace Diameter
          */
         void deploy(ByteArray& byteArray) const;
 
+        /**
+         * @brief Method for serializing AVP to raw
+         * memory. calculateLength(true) bytes are
+         * written, including zero padding.
+         * @param data Pointer to destination.
+         * @return Pointer past written bytes.
+         */
+        uint8_t* deploy(uint8_t* data) const;
+
+        /**
+         * @brief Method for storing current wire encoding.
+         * Until AVP is modified, deploying copies stored
+         * bytes instead of encoding header and data.
+         * @return Reference to constructor.
+         */
+        AVP& memoize();
+
+        /**
+         * @brief Method for checking is wire encoding stored.
+         * setHeader, setData, updateLength and non-const
+         * header/data accessors drop it.
+         * @return Is memoized.
+         */
+        bool isMemoized() const;
+
     private:
+        friend class AVPView;
+
+        /**
+         * @brief Method for dropping stored wire encoding.
+         */
+        void forget();
+
         Header m_header;
         Data m_data;
+
+        // Stored wire encoding with padding.
+        // Empty if AVP is not memoized.
+        ByteArray m_wire;
     };
 }
 
@@ -0,0 +1,79 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "AVP.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Address of AVP inside grouped AVPs. First
+     * step selects top-level AVP, every next step selects
+     * child of previous one.
+     *
+     * Usage:
+     * @code
+     * // Subscription-Id -> Subscription-Id-Data
+     * auto path = Diameter::AVPPath()
+     *     .child(443)
+     *     .child(444);
+     * @endcode
+     */
+    class AVPPath
+    {
+    public:
+
+        /**
+         * @brief Path step.
+         */
+        struct Step
+        {
+            AVP::Header::AVPCodeType code;
+            AVP::Header::VendorIdType vendorId; //< 0 for AVPs without vendor specific bit
+            uint32_t occurrence;                //< Index among siblings with same code and vendor id
+        };
+
+        /**
+         * @brief Default constructor. Creates empty path.
+         */
+        AVPPath();
+
+        /**
+         * @brief Method for adding step to path.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @param occurrence Index among siblings with same
+         * code and vendor id.
+         * @return Reference to path.
+         */
+        AVPPath& child(AVP::Header::AVPCodeType code,
+                       AVP::Header::VendorIdType vendorId=0,
+                       uint32_t occurrence=0);
+
+        /**
+         * @brief Method for getting steps.
+         * @return Steps from top-level AVP.
+         */
+        const std::vector<Step>& steps() const;
+
+        /**
+         * @brief Method for getting number of steps.
+         * @return Depth.
+         */
+        uint32_t depth() const;
+
+        /**
+         * @brief Method for checking is path empty.
+         * @return Is empty.
+         */
+        bool empty() const;
+
+    private:
+        std::vector<Step> m_steps;
+    };
+}
@@ -0,0 +1,293 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ByteArray.hpp>
+#include "AVP.hpp"
+#include "ParseResult.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Read-only view of serialized AVP.
+     * It does not own or copy memory, it points into
+     * caller-owned buffer, that has to outlive the view.
+     * Fields are decoded on every access.
+     */
+    class AVPView
+    {
+    public:
+
+        /**
+         * @brief Forward iterator over sequence of
+         * serialized AVPs. It's used for iterating packet
+         * AVPs and grouped AVP children. Every AVP is checked
+         * before it's reached, iteration stops at malformed
+         * AVP without exception.
+         */
+        class Iterator
+        {
+        public:
+
+            /**
+             * @brief Default constructor.
+             */
+            Iterator();
+
+            /**
+             * @brief Constructor.
+             * @param position Pointer to first AVP.
+             * @param end Pointer past last byte of AVPs sequence.
+             */
+            Iterator(const uint8_t* position, const uint8_t* end);
+
+            /**
+             * @brief Method for getting view of current AVP.
+             * @return AVP view.
+             */
+            AVPView operator*() const;
+
+            /**
+             * @brief Method for moving to next AVP.
+             * @return Reference to iterator.
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Method for getting result of checking
+             * AVPs. If malformed AVP was met, iterator is
+             * equal to end iterator.
+             * @return Parsing result. Offset is relative
+             * to first AVP of sequence.
+             */
+            ParseResult result() const;
+
+            /**
+             * @brief Equality operator.
+             * @param rhs Other iterator.
+             * @return Are iterators equal.
+             */
+            bool operator==(const Iterator& rhs) const;
+
+            /**
+             * @brief Inequality operator.
+             * @param rhs Other iterator.
+             * @return Are iterators not equal.
+             */
+            bool operator!=(const Iterator& rhs) const;
+
+        private:
+            /**
+             * @brief Method for checking AVP at current
+             * position. Malformed AVP ends iteration.
+             */
+            void check();
+
+            const uint8_t* m_begin;
+            const uint8_t* m_position;
+            const uint8_t* m_end;
+            ParseResult m_result;
+        };
+
+        /**
+         * @brief Default constructor. Creates empty view.
+         */
+        AVPView();
+
+        /**
+         * @brief Parsing constructor. Checks that AVP header
+         * and padded AVP fits into buffer. Otherwise
+         * std::invalid_argument exception will be thrown.
+         * @param data Pointer to first byte of AVP.
+         * @param size Number of available bytes.
+         */
+        AVPView(const uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Exception-free parsing method. Performs the
+         * same checks as parsing constructor, but reports
+         * failure with result instead of exception.
+         * @param data Pointer to first byte of AVP.
+         * @param size Number of available bytes.
+         * @param view Result view. It's untouched on failure.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult tryParse(const uint8_t* data, std::size_t size, AVPView& view);
+
+        /**
+         * @brief Method for getting AVP code.
+         * @return AVP code.
+         */
+        AVP::Header::AVPCodeType avpCode() const;
+
+        /**
+         * @brief Method for getting AVP flags.
+         * @return AVP flags.
+         */
+        AVP::Header::Flags flags() const;
+
+        /**
+         * @brief Method for getting AVP length (with header,
+         * without padding).
+         * @return AVP length.
+         */
+        AVP::Header::LengthType length() const;
+
+        /**
+         * @brief Method for getting AVP length with padding.
+         * @return Padded AVP length.
+         */
+        AVP::Header::LengthType paddedLength() const;
+
+        /**
+         * @brief Method for getting Vendor Id.
+         * If there is no vendor id, std::invalid_argument
+         * exception will be thrown.
+         * @return Vendor Id value.
+         */
+        AVP::Header::VendorIdType vendorId() const;
+
+        /**
+         * @brief Method for getting AVP header size.
+         * @return Header size in bytes.
+         */
+        AVP::Header::LengthType headerSize() const;
+
+        /**
+         * @brief Method for decoding AVP header.
+         * @return AVP header.
+         */
+        AVP::Header header() const;
+
+        /**
+         * @brief Method for getting pointer to first
+         * byte of serialized AVP.
+         * @return Pointer to AVP.
+         */
+        const uint8_t* raw() const;
+
+        /**
+         * @brief Method for getting pointer to first
+         * byte of AVP value.
+         * @return Pointer to value.
+         */
+        const uint8_t* data() const;
+
+        /**
+         * @brief Method for getting AVP value size in
+         * bytes (without padding).
+         * @return Value size.
+         */
+        uint32_t dataSize() const;
+
+        /**
+         * @brief Method for copying value to octet string.
+         * @return Byte array.
+         */
+        ByteArray toOctetString() const;
+
+        /**
+         * @brief Method for getting signed 32 bit integer.
+         * If it's not 32 bit integer, std::invalid_argument
+         * exception will be thrown.
+         * @return Value.
+         */
+        int32_t toInteger32() const;
+
+        /**
+         * @brief Method for getting signed 64 bit integer.
+         * If it's not 64 bit integer, std::invalid_argument
+         * exception will be thrown.
+         * @return Value.
+         */
+        int64_t toInteger64() const;
+
+        /**
+         * @brief Method for getting unsigned 32 bit integer.
+         * If it's not 32 bit integer, std::invalid_argument
+         * exception will be thrown.
+         * @return Value.
+         */
+        uint32_t toUnsigned32() const;
+
+        /**
+         * @brief Method for getting unsigned 64 bit integer.
+         * If it's not 64 bit integer, std::invalid_argument
+         * exception will be thrown.
+         * @return Value.
+         */
+        uint64_t toUnsigned64() const;
+
+        /**
+         * @brief Method for getting iterator to first
+         * child AVP of grouped AVP.
+         * @return Iterator.
+         */
+        Iterator begin() const;
+
+        /**
+         * @brief Method for getting iterator past last
+         * child AVP of grouped AVP.
+         * @return Iterator.
+         */
+        Iterator end() const;
+
+        /**
+         * @brief Exception-free method for checking
+         * child AVPs of grouped AVP. Iteration over
+         * children stops at the same AVP.
+         * @return Parsing result. Offset is relative
+         * to first byte of value.
+         */
+        ParseResult checkChildren() const;
+
+        /**
+         * @brief Method for checking AVP validness.
+         * @return AVP validness.
+         */
+        bool isValid() const;
+
+        /**
+         * @brief Method for checking is view empty.
+         * @return Is empty.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Method for building AVP object
+         * from view. Value will be copied.
+         * @return AVP.
+         */
+        AVP toAVP() const;
+
+        /**
+         * @brief Method for building AVP object, that
+         * keeps original wire bytes with padding. Untouched
+         * AVP is deployed byte-exact.
+         * @return Memoized AVP.
+         */
+        AVP toMemoizedAVP() const;
+
+        /**
+         * @brief Method for decoding view into existing
+         * AVP object. Buffers of AVP are reused.
+         * @param avp AVP. Its previous content is replaced.
+         */
+        void toAVP(AVP& avp) const;
+
+        /**
+         * @brief Method for decoding view into existing
+         * AVP object, that keeps original wire bytes.
+         * Buffers of AVP are reused.
+         * @param avp AVP. Its previous content is replaced.
+         */
+        void toMemoizedAVP(AVP& avp) const;
+
+    private:
+        const uint8_t* m_data;
+    };
+}
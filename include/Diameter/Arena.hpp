@@ -0,0 +1,217 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <new>
+#include <type_traits>
+
+namespace Diameter
+{
+    /**
+     * @brief Monotonic memory arena. Memory is handed out
+     * from big blocks by bumping offset and is never freed
+     * separately. Caller resets arena between messages,
+     * so memory is reused.
+     *
+     * Blocks are kept on reset. If arena had to grow, blocks
+     * are replaced with one block of the same total size,
+     * so after warm-up every message fits into one block and
+     * arena does not allocate at all.
+     *
+     * Everything, that was allocated from arena, has to be
+     * destroyed before reset.
+     */
+    class Arena
+    {
+    public:
+
+        /**
+         * @brief Constructor. Memory is not allocated
+         * until first allocation.
+         * @param blockSize Minimal size of block in bytes.
+         */
+        explicit Arena(std::size_t blockSize=4096);
+
+        /**
+         * @brief Destructor.
+         */
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * @brief Method for allocating memory.
+         * @param size Number of bytes.
+         * @param alignment Alignment. Power of 2.
+         * @return Pointer to memory.
+         */
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Method for releasing all allocations
+         * at once.
+         */
+        void reset();
+
+        /**
+         * @brief Method for getting number of bytes,
+         * allocated since last reset.
+         * @return Number of bytes.
+         */
+        std::size_t allocated() const;
+
+        /**
+         * @brief Method for getting total size of blocks.
+         * @return Number of bytes.
+         */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Method for getting number of blocks.
+         * @return Number of blocks.
+         */
+        std::size_t numberOfBlocks() const;
+
+    private:
+
+        /**
+         * @brief Memory block.
+         */
+        struct Block
+        {
+            uint8_t* data;
+            std::size_t size;
+        };
+
+        /**
+         * @brief Method for adding block.
+         * @param size Block size.
+         */
+        void addBlock(std::size_t size);
+
+        std::vector<Block> m_blocks;
+        std::size_t m_blockSize;
+        std::size_t m_current; //< Index of block, that is used now
+        std::size_t m_offset;  //< Offset in current block
+        std::size_t m_allocated;
+    };
+
+    /**
+     * @brief Allocator for standard containers, that takes
+     * memory from arena. Default constructed allocator uses
+     * global operator new, so containers work as usual.
+     *
+     * Copy of container gets default allocator, so copies
+     * do not depend on arena. Moved container keeps its
+     * memory and arena.
+     * @tparam T Value type.
+     */
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+
+        using value_type = T;
+
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        /**
+         * @brief Constructor. Global operator new is used.
+         */
+        ArenaAllocator() noexcept :
+            m_arena(nullptr)
+        {
+
+        }
+
+        /**
+         * @brief Constructor.
+         * @param arena Arena. nullptr for global operator new.
+         */
+        explicit ArenaAllocator(Arena* arena) noexcept :
+            m_arena(arena)
+        {
+
+        }
+
+        /**
+         * @brief Rebinding constructor.
+         * @param other Allocator of other type.
+         */
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+            m_arena(other.arena())
+        {
+
+        }
+
+        /**
+         * @brief Method for allocating memory.
+         * @param n Number of values.
+         * @return Pointer to memory.
+         */
+        T* allocate(std::size_t n)
+        {
+            if (m_arena == nullptr)
+            {
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+            }
+
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /**
+         * @brief Method for freeing memory. Arena
+         * memory is freed by arena reset.
+         * @param pointer Pointer to memory.
+         */
+        void deallocate(T* pointer, std::size_t) noexcept
+        {
+            if (m_arena == nullptr)
+            {
+                ::operator delete(pointer);
+            }
+        }
+
+        /**
+         * @brief Method for getting allocator of container
+         * copy.
+         * @return Default allocator.
+         */
+        ArenaAllocator select_on_container_copy_construction() const
+        {
+            return ArenaAllocator();
+        }
+
+        /**
+         * @brief Method for getting arena.
+         * @return Arena or nullptr.
+         */
+        Arena* arena() const noexcept
+        {
+            return m_arena;
+        }
+
+    private:
+        Arena* m_arena;
+    };
+
+    template<typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+    {
+        return lhs.arena() == rhs.arena();
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+    {
+        return lhs.arena() != rhs.arena();
+    }
+}
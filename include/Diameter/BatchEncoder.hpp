@@ -0,0 +1,101 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "MessageTemplate.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for serializing many messages back to
+     * back into one buffer (eg. burst of answers for one
+     * connection), so it can be sent with one call.
+     *
+     * Lengths of all messages are summed first, so buffer
+     * grows once, then every message is written right into
+     * it. Offset of every message in buffer is reported.
+     *
+     * Usage:
+     * @code
+     * ByteArray buffer;
+     * std::vector<std::size_t> offsets;
+     *
+     * Diameter::BatchEncoder::encode(answers, buffer, offsets);
+     *
+     * send(socket, buffer.data(), buffer.size(), 0);
+     * @endcode
+     */
+    class BatchEncoder
+    {
+    public:
+
+        /**
+         * @brief Method for serializing packets. If any packet
+         * is not valid, std::logic_error exception will be
+         * thrown and byte array with offsets are left untouched.
+         * @param packets Pointer to first packet.
+         * @param count Number of packets.
+         * @param byteArray Byte array, that packets will be appended to.
+         * @param offsets Container, that offset of every packet in
+         * byte array will be appended to.
+         * @param checkValid Validate packets before deploying.
+         */
+        static void encode(const Packet* packets,
+                           std::size_t count,
+                           ByteArray& byteArray,
+                           std::vector<std::size_t>& offsets,
+                           bool checkValid=true);
+
+        /**
+         * @brief Method for serializing packets.
+         * @param packets Packets.
+         * @param byteArray Byte array, that packets will be appended to.
+         * @param offsets Container, that offset of every packet in
+         * byte array will be appended to.
+         * @param checkValid Validate packets before deploying.
+         */
+        static void encode(const std::vector<Packet>& packets,
+                           ByteArray& byteArray,
+                           std::vector<std::size_t>& offsets,
+                           bool checkValid=true);
+
+        /**
+         * @brief Method for stamping many messages from one
+         * template. If any set of values is wrong,
+         * std::invalid_argument exception will be thrown and
+         * byte array with offsets are left untouched.
+         * @param messageTemplate Template.
+         * @param values Pointer to slot values of first message.
+         * @param count Number of messages.
+         * @param byteArray Byte array, that messages will be appended to.
+         * @param offsets Container, that offset of every message in
+         * byte array will be appended to.
+         */
+        static void stamp(const MessageTemplate& messageTemplate,
+                          const std::vector<MessageTemplate::SlotValue>* values,
+                          std::size_t count,
+                          ByteArray& byteArray,
+                          std::vector<std::size_t>& offsets);
+
+        /**
+         * @brief Method for stamping many messages from one
+         * template.
+         * @param messageTemplate Template.
+         * @param values Slot values of every message.
+         * @param byteArray Byte array, that messages will be appended to.
+         * @param offsets Container, that offset of every message in
+         * byte array will be appended to.
+         */
+        static void stamp(const MessageTemplate& messageTemplate,
+                          const std::vector<std::vector<MessageTemplate::SlotValue>>& values,
+                          ByteArray& byteArray,
+                          std::vector<std::size_t>& offsets);
+    };
+}
@@ -0,0 +1,114 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "Packet.hpp"
+#include "PacketView.hpp"
+#include "ParseResult.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for parsing many back-to-back
+     * messages from one contiguous buffer (eg. drained
+     * socket).
+     *
+     * Parsing is done block by block. For every block
+     * message boundaries are found with one scan over length
+     * fields, then all packet headers of the block are
+     * validated in one tight loop and then AVPs of every
+     * message are walked. Block offsets live on stack.
+     *
+     * Incomplete message at the end of buffer is not an
+     * error. It's left unconsumed.
+     */
+    class BatchParser
+    {
+    public:
+
+        /**
+         * @brief Method for splitting buffer into packet views.
+         * Views point into data.
+         * @param data Pointer to first byte of first message.
+         * @param size Buffer size.
+         * @param views Container, that views will be appended to.
+         * It's untouched on failure.
+         * @param consumed Number of bytes, taken by complete messages.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult split(const uint8_t* data,
+                                 std::size_t size,
+                                 std::vector<PacketView>& views,
+                                 std::size_t& consumed);
+
+        /**
+         * @brief Method for parsing buffer into packets.
+         * @param data Pointer to first byte of first message.
+         * @param size Buffer size.
+         * @param packets Container, that packets will be appended to.
+         * It's untouched on failure.
+         * @param consumed Number of bytes, taken by complete messages.
+         * @param mode Parsing mode.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult parse(const uint8_t* data,
+                                 std::size_t size,
+                                 std::vector<Packet>& packets,
+                                 std::size_t& consumed,
+                                 Packet::ParseMode mode=Packet::ParseMode::Eager);
+
+    private:
+
+        const static uint32_t BlockSize = 64; //< Number of messages, processed per block
+
+        /**
+         * @brief Method for walking messages block by block.
+         * Every validated message view is passed to handler
+         * right away, while it's still in cache.
+         * @tparam Handler Callable with `void(const PacketView&)` signature.
+         * @param data Pointer to first byte of first message.
+         * @param size Buffer size.
+         * @param consumed Number of bytes, taken by complete messages.
+         * It's untouched on failure.
+         * @param handler Handler.
+         * @return Parsing result. Offset is relative to data.
+         */
+        template<typename Handler>
+        static ParseResult walk(const uint8_t* data,
+                                std::size_t size,
+                                std::size_t& consumed,
+                                Handler handler);
+
+        /**
+         * @brief Method for finding boundaries of next
+         * block of messages. Scan stops at first incomplete
+         * message or at message with length smaller than header.
+         * @param data Pointer to first byte of first message.
+         * @param size Buffer size.
+         * @param pointer Offset of block. It's moved past found messages.
+         * @param offsets Array of BlockSize message offsets.
+         * @return Number of found messages.
+         */
+        static uint32_t scan(const uint8_t* data,
+                             std::size_t size,
+                             std::size_t& pointer,
+                             uint32_t* offsets);
+
+        /**
+         * @brief Method for validating packet headers
+         * of found messages.
+         * @param data Pointer to first byte of first message.
+         * @param offsets Message offsets.
+         * @param count Number of messages.
+         * @return Validation result.
+         */
+        static ParseResult validateHeaders(const uint8_t* data,
+                                           const uint32_t* offsets,
+                                           uint32_t count);
+    };
+}
@@ -0,0 +1,248 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "AVPView.hpp"
+#include "ParseResult.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Compact representation of Diameter packet.
+     * AVP header fields are kept in parallel arrays
+     * (codes, vendor ids, flags, lengths and offsets),
+     * and serialized AVPs are kept in one payload buffer.
+     * Lookup by code and validation stream through
+     * contiguous arrays instead of touching every AVP
+     * object. AVPs are returned as views into payload,
+     * that are valid until packet is modified.
+     */
+    class CompactPacket
+    {
+    public:
+
+        /**
+         * @brief Default constructor.
+         */
+        CompactPacket();
+
+        /**
+         * @brief Parsing constructor. Packet is copied.
+         * If AVPs are malformed, std::invalid_argument
+         * exception will be thrown.
+         * @param data Pointer to first byte of packet.
+         * @param size Packet size in bytes.
+         */
+        CompactPacket(const uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Parsing constructor.
+         * @param byteArray Byte array.
+         */
+        explicit CompactPacket(const ByteArray& byteArray);
+
+        /**
+         * @brief Converting constructor. AVPs of packet
+         * are serialized into payload. If some AVP is
+         * invalid, std::invalid_argument exception will
+         * be thrown.
+         * @param packet Packet.
+         */
+        explicit CompactPacket(const Packet& packet);
+
+        /**
+         * @brief Exception-free parsing method.
+         * Storage of packet is reused.
+         * @param data Pointer to first byte of packet.
+         * @param size Packet size in bytes.
+         * @param packet Result packet. It's untouched on failure.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult tryParse(const uint8_t* data, std::size_t size, CompactPacket& packet);
+
+        /**
+         * @brief Method for setting packet header.
+         * @param header Header.
+         * @return Reference to packet.
+         */
+        CompactPacket& setHeader(Packet::Header header);
+
+        /**
+         * @brief Method for getting packet header.
+         * @return Header.
+         */
+        const Packet::Header& header() const;
+
+        /**
+         * @brief Method for getting packet header.
+         * @return Reference to header.
+         */
+        Packet::Header& header();
+
+        /**
+         * @brief Method for adding AVP to the end of packet.
+         * AVP is serialized into payload, so its length
+         * has to be up to date. If AVP is invalid,
+         * std::invalid_argument exception will be thrown
+         * and packet is untouched.
+         * @param avp AVP.
+         * @return Reference to packet.
+         */
+        CompactPacket& addAVP(const AVP& avp);
+
+        /**
+         * @brief Method for getting number of AVPs.
+         * @return Number of AVPs.
+         */
+        uint32_t numberOfAVPs() const;
+
+        /**
+         * @brief Method for getting AVP view by index.
+         * If there is no AVP with this index,
+         * std::invalid_argument exception will be thrown.
+         * @param index Index.
+         * @return AVP view.
+         */
+        AVPView avp(uint32_t index) const;
+
+        /**
+         * @brief Method for getting AVP code by index.
+         * @param index Index. Has to be less than numberOfAVPs().
+         * @return AVP code.
+         */
+        AVP::Header::AVPCodeType avpCode(uint32_t index) const;
+
+        /**
+         * @brief Method for getting AVP vendor id by index.
+         * @param index Index. Has to be less than numberOfAVPs().
+         * @return Vendor id. 0 for AVPs without vendor
+         * specific bit.
+         */
+        AVP::Header::VendorIdType vendorId(uint32_t index) const;
+
+        /**
+         * @brief Method for getting AVP flags by index.
+         * @param index Index. Has to be less than numberOfAVPs().
+         * @return AVP flags.
+         */
+        AVP::Header::Flags flags(uint32_t index) const;
+
+        /**
+         * @brief Method for getting AVP length (with header,
+         * without padding) by index.
+         * @param index Index. Has to be less than numberOfAVPs().
+         * @return AVP length.
+         */
+        AVP::Header::LengthType length(uint32_t index) const;
+
+        /**
+         * @brief Method for finding first AVP with
+         * code and vendor id. Codes are scanned linearly.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return AVP index or Packet::NoAVP if there is
+         * no such AVP.
+         */
+        uint32_t find(AVP::Header::AVPCodeType code,
+                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for finding all AVPs with
+         * code and vendor id.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return Ascending AVP indices.
+         */
+        std::vector<uint32_t> findAll(AVP::Header::AVPCodeType code,
+                                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for getting iterator to first AVP.
+         * @return Iterator.
+         */
+        AVPView::Iterator begin() const;
+
+        /**
+         * @brief Method for getting iterator past last AVP.
+         * @return Iterator.
+         */
+        AVPView::Iterator end() const;
+
+        /**
+         * @brief Method for checking is packet valid.
+         * Recorded AVP lengths are checked to lead from
+         * one AVP to the next.
+         * @return Packet validness.
+         */
+        bool isValid() const;
+
+        /**
+         * @brief Method for calculating actual packet length.
+         * @return Actual packet length.
+         */
+        Packet::Header::MessageLengthType calculateLength() const;
+
+        /**
+         * @brief Method for updating length in header.
+         * @return Reference to packet.
+         */
+        CompactPacket& updateLength();
+
+        /**
+         * @brief Method for removing all AVPs.
+         * Capacity of arrays is kept.
+         * @return Reference to packet.
+         */
+        CompactPacket& clear();
+
+        /**
+         * @brief Method for deploying packet as byte array.
+         * @param checkValid Validate packet before deploying.
+         * @return Byte array.
+         */
+        ByteArray deploy(bool checkValid=true) const;
+
+        /**
+         * @brief Method for deploying packet as byte array.
+         * Packet will be appended to deploy.
+         * @param byteArray Byte array.
+         * @param checkValid Validate packet before deploying.
+         */
+        void deploy(ByteArray& byteArray, bool checkValid=true) const;
+
+        /**
+         * @brief Method for building packet object.
+         * AVP values will be copied.
+         * @return Packet.
+         */
+        Packet toPacket() const;
+
+    private:
+
+        /**
+         * @brief Method for recording header fields of
+         * AVP, that is already in payload.
+         * @param offset Offset of AVP in payload.
+         */
+        void record(uint32_t offset);
+
+        Packet::Header m_header;
+
+        std::vector<AVP::Header::AVPCodeType> m_codes;
+        std::vector<AVP::Header::VendorIdType> m_vendorIds;
+        std::vector<AVP::Header::Flags::Type> m_flags;
+        std::vector<AVP::Header::LengthType> m_lengths;
+        std::vector<uint32_t> m_offsets;
+
+        std::vector<uint8_t> m_payload;
+    };
+}
@@ -0,0 +1,242 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "AVP.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for writing messages sequentially into
+     * caller buffer without building Packet/AVP objects.
+     *
+     * Message and grouped AVP lengths are reserved when
+     * scope is opened and written when it's closed, so
+     * every byte is written once. Open scopes are kept
+     * on fixed size stack, encoder does not allocate.
+     *
+     * Running out of buffer, unbalanced scopes or too
+     * deep nesting cause std::invalid_argument exception.
+     *
+     * Usage:
+     * @code
+     * Diameter::Encoder encoder(buffer, sizeof(buffer));
+     *
+     * encoder
+     *     .beginMessage(header)
+     *         .putOctetString(263, sessionId)
+     *         .putUnsigned32(415, requestNumber)
+     *         .beginGrouped(446)
+     *             .putUnsigned64(421, totalOctets)
+     *         .endGrouped()
+     *     .endMessage();
+     *
+     * send(buffer, encoder.size());
+     * @endcode
+     */
+    class Encoder
+    {
+    public:
+
+        const static uint32_t MaxDepth = 16; //< Maximum number of open scopes
+
+        /**
+         * @brief Constructor.
+         * @param data Pointer to buffer. Has to outlive encoder.
+         * @param capacity Buffer size in bytes.
+         */
+        Encoder(uint8_t* data, std::size_t capacity);
+
+        /**
+         * @brief Method for starting message. Header is
+         * written as is, message length is written by
+         * endMessage(). Message can't be started inside
+         * of another scope.
+         * @param header Message header.
+         * @return Reference to encoder.
+         */
+        Encoder& beginMessage(const Packet::Header& header);
+
+        /**
+         * @brief Method for finishing message, started
+         * by beginMessage(). All grouped AVPs have to
+         * be finished.
+         * @return Reference to encoder.
+         */
+        Encoder& endMessage();
+
+        /**
+         * @brief Method for starting grouped AVP. Following
+         * AVPs are written as its value until endGrouped().
+         * Vendor specific bit is set if vendor id is not 0.
+         * @param code AVP code.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& beginGrouped(AVP::Header::AVPCodeType code,
+                              AVP::Header::Flags flags=AVP::Header::Flags(),
+                              AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for finishing grouped AVP, started
+         * by beginGrouped().
+         * @return Reference to encoder.
+         */
+        Encoder& endGrouped();
+
+        /**
+         * @brief Method for writing OctetString AVP.
+         * @param code AVP code.
+         * @param data Pointer to value.
+         * @param size Value size in bytes.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& putOctetString(AVP::Header::AVPCodeType code,
+                                const uint8_t* data,
+                                std::size_t size,
+                                AVP::Header::Flags flags=AVP::Header::Flags(),
+                                AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for writing OctetString AVP.
+         * @param code AVP code.
+         * @param value Value.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& putOctetString(AVP::Header::AVPCodeType code,
+                                const ByteArray& value,
+                                AVP::Header::Flags flags=AVP::Header::Flags(),
+                                AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for writing Integer32 AVP.
+         * @param code AVP code.
+         * @param value Value.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& putInteger32(AVP::Header::AVPCodeType code,
+                              int32_t value,
+                              AVP::Header::Flags flags=AVP::Header::Flags(),
+                              AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for writing Integer64 AVP.
+         * @param code AVP code.
+         * @param value Value.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& putInteger64(AVP::Header::AVPCodeType code,
+                              int64_t value,
+                              AVP::Header::Flags flags=AVP::Header::Flags(),
+                              AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for writing Unsigned32 AVP.
+         * @param code AVP code.
+         * @param value Value.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& putUnsigned32(AVP::Header::AVPCodeType code,
+                               uint32_t value,
+                               AVP::Header::Flags flags=AVP::Header::Flags(),
+                               AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for writing Unsigned64 AVP.
+         * @param code AVP code.
+         * @param value Value.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @return Reference to encoder.
+         */
+        Encoder& putUnsigned64(AVP::Header::AVPCodeType code,
+                               uint64_t value,
+                               AVP::Header::Flags flags=AVP::Header::Flags(),
+                               AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for writing already built AVP.
+         * AVP has to be valid.
+         * @param avp AVP.
+         * @return Reference to encoder.
+         */
+        Encoder& putAVP(const AVP& avp);
+
+        /**
+         * @brief Method for getting number of written bytes.
+         * @return Size in bytes.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Method for getting number of open scopes.
+         * @return Depth.
+         */
+        uint32_t depth() const;
+
+        /**
+         * @brief Method for starting over at beginning
+         * of buffer. Open scopes are dropped.
+         * @return Reference to encoder.
+         */
+        Encoder& reset();
+
+    private:
+
+        /**
+         * @brief Method for reserving bytes at the end
+         * of written data.
+         * @param size Number of bytes.
+         * @return Pointer to first reserved byte.
+         */
+        uint8_t* reserve(std::size_t size);
+
+        /**
+         * @brief Method for writing AVP with fixed
+         * size value. Value has to be written by caller.
+         * @param code AVP code.
+         * @param flags AVP flags.
+         * @param vendorId Vendor id.
+         * @param size Value size.
+         * @return Pointer to value.
+         */
+        uint8_t* putHeader(AVP::Header::AVPCodeType code,
+                           AVP::Header::Flags flags,
+                           AVP::Header::VendorIdType vendorId,
+                           uint32_t size);
+
+        /**
+         * @brief Method for closing scope and writing its
+         * length.
+         * @param lengthOffset Offset of length field from
+         * scope start.
+         */
+        void close(uint32_t lengthOffset);
+
+        uint8_t* m_data;
+        std::size_t m_capacity;
+        std::size_t m_size;
+
+        // Offsets of open message and grouped AVPs
+        std::size_t m_scopes[MaxDepth];
+        uint32_t m_depth;
+        bool m_message; //< First scope is message
+    };
+}
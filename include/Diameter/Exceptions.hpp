@@ -0,0 +1,16 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+// If library is built with DIAMETER_NO_EXCEPTIONS,
+// every place, that throws exception, aborts instead.
+// Exception object is not constructed in that case.
+#ifdef DIAMETER_NO_EXCEPTIONS
+#   include <cstdlib>
+#   define DIAMETER_THROW(exception) std::abort()
+#else
+#   include <stdexcept>
+#   define DIAMETER_THROW(exception) throw exception
+#endif
@@ -0,0 +1,109 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for patching header fields of already
+     * serialized packet in place. Every setter is a few
+     * stores at fixed offset, packet is not decoded.
+     *
+     * Buffer is validated on construction, values are
+     * validated by setters. Invalid values cause
+     * std::invalid_argument exception and leave buffer
+     * untouched.
+     *
+     * Usage:
+     * @code
+     * Diameter::HeaderPatcher(buffer)
+     *     .setHBHIdentifier(nextHopByHop)
+     *     .setFlag(Diameter::Packet::Header::Flags::Bits::ReTransmitted, true);
+     * @endcode
+     */
+    class HeaderPatcher
+    {
+    public:
+
+        /**
+         * @brief Constructor. If buffer is smaller than
+         * header or version is not 1, std::invalid_argument
+         * exception will be thrown.
+         * @param data Pointer to first byte of packet.
+         * Has to outlive patcher.
+         * @param size Number of available bytes.
+         */
+        HeaderPatcher(uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Constructor.
+         * @param byteArray Serialized packet. Has to outlive patcher.
+         */
+        explicit HeaderPatcher(ByteArray& byteArray);
+
+        /**
+         * @brief Method for setting message length.
+         * Length has to be at least header size, fit
+         * into 24 bits and into patched buffer.
+         * @param length Message length.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setMessageLength(Packet::Header::MessageLengthType length);
+
+        /**
+         * @brief Method for setting command flags.
+         * Reserved bits have to be zero.
+         * @param flags Flags.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setCommandFlags(const Packet::Header::Flags& flags);
+
+        /**
+         * @brief Method for setting single command flag.
+         * @param bit Bit.
+         * @param value Value.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setFlag(Packet::Header::Flags::Bits bit, bool value);
+
+        /**
+         * @brief Method for setting command code.
+         * Code has to fit into 24 bits.
+         * @param code Command code.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setCommandCode(Packet::Header::CommandCodeType code);
+
+        /**
+         * @brief Method for setting ApplicationId.
+         * @param id ApplicationId.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setApplicationId(Packet::Header::ApplicationIdType id);
+
+        /**
+         * @brief Method for setting Hop-By-Hop identifier.
+         * @param id Hop-By-Hop identifier.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setHBHIdentifier(Packet::Header::HBHType id);
+
+        /**
+         * @brief Method for setting End-To-End identifier.
+         * @param id End-To-End identifier.
+         * @return Reference to patcher.
+         */
+        HeaderPatcher& setETEIdentifier(Packet::Header::ETEType id);
+
+    private:
+        uint8_t* m_data;
+        std::size_t m_size;
+    };
+}
@@ -0,0 +1,76 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "AVP.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Set of (AVP code, vendor id) pairs, that
+     * parser has to decode. Other AVPs are skipped by
+     * their length field and kept as raw bytes.
+     *
+     * Set is compiled while pairs are added: keys are
+     * kept sorted and 64-bit filter of code bits rejects
+     * most of uninteresting AVPs without search.
+     */
+    class InterestSet
+    {
+    public:
+
+        /**
+         * @brief Default constructor. Creates empty set.
+         */
+        InterestSet();
+
+        /**
+         * @brief Method for adding AVP to set.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return Reference to set.
+         */
+        InterestSet& add(AVP::Header::AVPCodeType code,
+                         AVP::Header::VendorIdType vendorId=0);
+
+        /**
+         * @brief Method for checking is AVP in set.
+         * @param code AVP code.
+         * @param vendorId Vendor id.
+         * @return Is AVP in set.
+         */
+        bool contains(AVP::Header::AVPCodeType code,
+                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for getting number of pairs in set.
+         * @return Number of pairs.
+         */
+        uint32_t size() const;
+
+        /**
+         * @brief Method for checking is set empty.
+         * @return Is empty.
+         */
+        bool empty() const;
+
+    private:
+
+        /**
+         * @brief Method for building key of pair.
+         * @param code AVP code.
+         * @param vendorId Vendor id.
+         * @return Key.
+         */
+        static uint64_t key(AVP::Header::AVPCodeType code,
+                            AVP::Header::VendorIdType vendorId);
+
+        std::vector<uint64_t> m_keys;
+        uint64_t m_filter;
+    };
+}
@@ -0,0 +1,212 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <ByteArray.hpp>
+#include "AVP.hpp"
+#include "AVPView.hpp"
+#include "AVPPath.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for adding and removing top-level AVPs
+     * of serialized message in place. Message is never
+     * decoded into Packet or AVP objects.
+     *
+     * AVP offsets are found with one walk on construction.
+     * Every edit moves message tail once, writes padding
+     * and updates message length in header.
+     */
+    class MessageEditor
+    {
+    public:
+
+        const static uint32_t NoAVP = UINT32_MAX; //< Result of failed AVP lookup
+
+        /**
+         * @brief Constructor. If message is malformed,
+         * std::invalid_argument exception will be thrown.
+         * @param message Serialized message. Has to outlive
+         * editor and must not be changed by other means.
+         */
+        explicit MessageEditor(ByteArray& message);
+
+        /**
+         * @brief Method for getting number of AVPs.
+         * @return Number of AVPs.
+         */
+        uint32_t numberOfAVPs() const;
+
+        /**
+         * @brief Method for getting AVP view by index.
+         * View is valid until next edit.
+         * If there is no AVP with this index,
+         * std::invalid_argument exception will be
+         * thrown.
+         * @param index Index.
+         * @return AVP view.
+         */
+        AVPView avp(uint32_t index) const;
+
+        /**
+         * @brief Method for finding first AVP with
+         * code and vendor id.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return AVP index or NoAVP if there is no such AVP.
+         */
+        uint32_t find(AVP::Header::AVPCodeType code,
+                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for getting view of nested AVP.
+         * View is valid until next edit. If there is no
+         * such AVP, std::invalid_argument exception will
+         * be thrown.
+         * @param path AVP path.
+         * @return AVP view.
+         */
+        AVPView avp(const AVPPath& path) const;
+
+        /**
+         * @brief Method for checking is there nested AVP.
+         * @param path AVP path.
+         * @return Is there such AVP.
+         */
+        bool contains(const AVPPath& path) const;
+
+        /**
+         * @brief Method for replacing value of nested AVP.
+         * Length of AVP, of every enclosing grouped AVP and
+         * of message are updated, message tail is moved once.
+         * If there is no such AVP or lengths overflow,
+         * std::invalid_argument exception will be thrown.
+         * Value may point into edited message.
+         * @param path AVP path.
+         * @param data Pointer to new value.
+         * @param size New value size.
+         * @return Reference to editor.
+         */
+        MessageEditor& setValue(const AVPPath& path, const uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Method for replacing value of nested AVP.
+         * @param path AVP path.
+         * @param value New value.
+         * @return Reference to editor.
+         */
+        MessageEditor& setValue(const AVPPath& path, const ByteArray& value);
+
+        /**
+         * @brief Method for appending AVP after last one.
+         * @param avp AVP object.
+         * @return Reference to editor.
+         */
+        MessageEditor& appendAVP(const AVP& avp);
+
+        /**
+         * @brief Method for appending already serialized AVP
+         * (eg. taken from another message) after last one.
+         * @param avp AVP view.
+         * @return Reference to editor.
+         */
+        MessageEditor& appendAVP(const AVPView& avp);
+
+        /**
+         * @brief Method for inserting AVP. If index is
+         * larger than number of AVPs or AVP is not valid,
+         * std::invalid_argument exception will be thrown.
+         * @param index Index of inserted AVP.
+         * @param avp AVP object.
+         * @return Reference to editor.
+         */
+        MessageEditor& insertAVP(uint32_t index, const AVP& avp);
+
+        /**
+         * @brief Method for inserting already serialized AVP.
+         * View may point into edited message.
+         * @param index Index of inserted AVP.
+         * @param avp AVP view.
+         * @return Reference to editor.
+         */
+        MessageEditor& insertAVP(uint32_t index, const AVPView& avp);
+
+        /**
+         * @brief Method for removing AVP. If there is no AVP
+         * with this index, std::invalid_argument exception
+         * will be thrown.
+         * @param index AVP index.
+         * @return Reference to editor.
+         */
+        MessageEditor& removeAVP(uint32_t index);
+
+        /**
+         * @brief Method for removing every AVP with code
+         * and vendor id (eg. Proxy-Info). Message tail is
+         * compacted in one pass.
+         * @param code AVP code.
+         * @param vendorId Vendor id.
+         * @return Number of removed AVPs.
+         */
+        uint32_t removeAll(AVP::Header::AVPCodeType code,
+                           AVP::Header::VendorIdType vendorId=0);
+
+    private:
+        friend class MessageTemplate;
+
+        /**
+         * @brief Method for opening gap in message.
+         * Following AVPs are moved once and their
+         * offsets are shifted. Header length is updated.
+         * @param index Index of AVP, that will occupy gap.
+         * @param size Gap size in bytes.
+         * @return Pointer to gap.
+         */
+        uint8_t* openGap(uint32_t index, uint32_t size);
+
+        /**
+         * @brief Method for finding offsets of every AVP
+         * on path. Nested AVPs are validated while walked.
+         * @param path AVP path.
+         * @param offsets Offsets from top-level AVP to addressed one.
+         * @return Is AVP found.
+         */
+        bool locate(const AVPPath& path, std::vector<uint32_t>& offsets) const;
+
+        /**
+         * @brief Method for checking does memory lie
+         * inside edited message. Such memory is moved
+         * or freed, when message is changed.
+         * @param data Pointer to memory.
+         * @return Is memory inside message.
+         */
+        bool isInside(const uint8_t* data) const;
+
+        /**
+         * @brief Method for writing message length to header.
+         */
+        void updateLength();
+
+        /**
+         * @brief Method for checking does AVP at offset
+         * match code and vendor id.
+         * @param offset AVP offset.
+         * @param code AVP code.
+         * @param vendorId Vendor id.
+         * @return Does AVP match.
+         */
+        bool matches(uint32_t offset,
+                     AVP::Header::AVPCodeType code,
+                     AVP::Header::VendorIdType vendorId) const;
+
+        ByteArray& m_message;
+        std::vector<uint32_t> m_offsets;
+    };
+}
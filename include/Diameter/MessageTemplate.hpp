@@ -0,0 +1,237 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "AVPPath.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for stamping out messages of same
+     * layout, that differ only in few values (eg.
+     * Session-Id, CC-Request-Number).
+     *
+     * Prototype packet is serialized once. Every slot
+     * addresses AVP, whose value is replaced on stamping.
+     * Offsets of slots and of length fields, affected by
+     * slot size change, are computed when slot is added.
+     * Stamping is copying of prototype between slots,
+     * writing of slot values and patching of precomputed
+     * length fields.
+     *
+     * Per message identifiers may be set afterwards
+     * with HeaderPatcher.
+     *
+     * Usage:
+     * @code
+     * Diameter::MessageTemplate ccr(prototype);
+     *
+     * auto sessionId = ccr.addSlot(Diameter::AVPPath().child(263));
+     * auto requestNumber = ccr.addSlot(Diameter::AVPPath().child(415));
+     *
+     * std::vector<Diameter::MessageTemplate::SlotValue> values(ccr.numberOfSlots());
+     *
+     * values[sessionId] = Diameter::MessageTemplate::SlotValue(session);
+     * values[requestNumber] = Diameter::MessageTemplate::SlotValue::fromUnsigned32(2);
+     *
+     * auto message = ccr.stamp(values);
+     * @endcode
+     */
+    class MessageTemplate
+    {
+    public:
+
+        const static uint32_t MaxSlots = 32; //< Maximum number of slots
+
+        /**
+         * @brief Value of slot. Points to external memory
+         * or holds integer value.
+         */
+        class SlotValue
+        {
+        public:
+
+            /**
+             * @brief Default constructor. Creates empty value.
+             */
+            SlotValue();
+
+            /**
+             * @brief Constructor. Data has to stay valid
+             * during stamping.
+             * @param data Pointer to value.
+             * @param size Value size.
+             */
+            SlotValue(const uint8_t* data, std::size_t size);
+
+            /**
+             * @brief Constructor. Byte array has to stay
+             * valid during stamping.
+             * @param value Value.
+             */
+            explicit SlotValue(const ByteArray& value);
+
+            // Value would point into destroyed temporary
+            SlotValue(ByteArray&&) = delete;
+
+            /**
+             * @brief Method for creating Unsigned32 value.
+             * @param value Value.
+             * @return Slot value.
+             */
+            static SlotValue fromUnsigned32(uint32_t value);
+
+            /**
+             * @brief Method for creating Unsigned64 value.
+             * @param value Value.
+             * @return Slot value.
+             */
+            static SlotValue fromUnsigned64(uint64_t value);
+
+            /**
+             * @brief Method for getting pointer to value.
+             * @return Pointer to value.
+             */
+            const uint8_t* data() const;
+
+            /**
+             * @brief Method for getting value size.
+             * @return Value size.
+             */
+            std::size_t size() const;
+
+        private:
+            const uint8_t* m_data; //< nullptr for integer values
+            std::size_t m_size;
+            uint8_t m_integer[8];
+        };
+
+        /**
+         * @brief Constructor. If prototype is invalid,
+         * std::invalid_argument exception will be thrown.
+         * @param prototype Prototype packet.
+         */
+        explicit MessageTemplate(const Packet& prototype);
+
+        /**
+         * @brief Method for adding slot. If there is no
+         * such AVP in prototype, slot overlaps another slot
+         * or there are MaxSlots slots already,
+         * std::invalid_argument exception will be thrown.
+         * @param path Path of AVP, whose value is replaced.
+         * @return Slot index.
+         */
+        uint32_t addSlot(const AVPPath& path);
+
+        /**
+         * @brief Method for getting number of slots.
+         * @return Number of slots.
+         */
+        uint32_t numberOfSlots() const;
+
+        /**
+         * @brief Method for getting serialized prototype.
+         * @return Serialized prototype.
+         */
+        const ByteArray& prototype() const;
+
+        /**
+         * @brief Method for calculating length of stamped
+         * message. If number of values differs from number
+         * of slots or length does not fit into 24 bits,
+         * std::invalid_argument exception will be thrown.
+         * @param values Slot values by slot index.
+         * @return Message length.
+         */
+        std::size_t calculateLength(const std::vector<SlotValue>& values) const;
+
+        /**
+         * @brief Method for stamping message.
+         * @param values Slot values by slot index.
+         * @return Serialized message.
+         */
+        ByteArray stamp(const std::vector<SlotValue>& values) const;
+
+        /**
+         * @brief Method for stamping message.
+         * Message will be appended to byte array.
+         * @param values Slot values by slot index.
+         * @param byteArray Byte array.
+         */
+        void stamp(const std::vector<SlotValue>& values, ByteArray& byteArray) const;
+
+        /**
+         * @brief Method for stamping message to raw memory.
+         * calculateLength bytes are written.
+         * @param values Slot values by slot index.
+         * @param data Pointer to destination.
+         * @return Pointer past written bytes.
+         */
+        uint8_t* stamp(const std::vector<SlotValue>& values, uint8_t* data) const;
+
+    private:
+
+        /**
+         * @brief Slot location in prototype.
+         */
+        struct Slot
+        {
+            uint32_t offset;                 //< AVP offset
+            uint32_t headerSize;             //< AVP header size
+            uint32_t paddedLength;           //< AVP padded length
+            std::vector<uint32_t> ancestors; //< Offsets of enclosing grouped AVPs
+        };
+
+        /**
+         * @brief Length field, that depends on slot sizes.
+         * Slots are referred by position in offset order.
+         * Slots before first precede field, slots
+         * in [first, last) are enclosed by it.
+         */
+        struct Fixup
+        {
+            uint32_t offset; //< Offset of 24-bit length field
+            uint32_t length; //< Length in prototype
+            uint32_t first;
+            uint32_t last;
+        };
+
+        /**
+         * @brief Method for rebuilding slot order and
+         * length fixups after slot was added.
+         */
+        void rebuild();
+
+        /**
+         * @brief Method for validating values and
+         * calculating shifts.
+         * @param values Slot values by slot index.
+         * @param shifts Array of numberOfSlots() + 1 elements.
+         * Shift of element k is total size change of first k
+         * slots in offset order.
+         * @return Message length.
+         */
+        std::size_t prepare(const std::vector<SlotValue>& values, int64_t* shifts) const;
+
+        /**
+         * @brief Method for writing message.
+         * @param values Slot values by slot index.
+         * @param shifts Shifts, calculated by prepare.
+         * @param data Pointer to destination.
+         * @return Pointer past written bytes.
+         */
+        uint8_t* write(const std::vector<SlotValue>& values, const int64_t* shifts, uint8_t* data) const;
+
+        ByteArray m_prototype;
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_order;
+        std::vector<Fixup> m_fixups;
+    };
+}
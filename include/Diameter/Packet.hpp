@@ -7,10 +7,18 @@
 #include <cstdint>
 #include <ByteArray.hpp>
 #include <vector>
+#include <utility>
 #include "AVP.hpp"
+#include "AVPView.hpp"
+#include "Arena.hpp"
+#include "ParseResult.hpp"
 
 namespace Diameter
 {
+    class PacketView;
+    class InterestSet;
+    class SegmentList;
+
     /**
      * @brief Constructor class for building Diameter packet.
      */
@@ -18,6 +26,16 @@ namespace Diameter
     {
     public:
 
+        /**
+         * @brief Packet parsing mode.
+         */
+        enum class ParseMode
+        {
+              Eager    //< Every AVP is decoded while parsing.
+            , Lazy     //< Only AVP offsets are recorded while parsing. AVP is decoded on first access.
+            , Memoized //< Every AVP is decoded and keeps its wire bytes until it's modified.
+        };
+
         /**
          * @brief Constructor class for building Diameter packet header.
          */
@@ -53,25 +71,41 @@ namespace Diameter
                 /**
                  * @brief Default constructor.
                  */
-                Flags();
+                constexpr Flags() :
+                    m_bits(0)
+                {
+
+                }
 
                 /**
                  * @brief Parsing constructor.
                  * @param flags Flags.
                  */
-                explicit Flags(Type flags);
+                constexpr explicit Flags(Type flags) :
+                    m_bits(flags)
+                {
+
+                }
 
                 /**
                  * @brief Move constructor.
                  * @param moved Moved object.
                  */
-                Flags(Flags&& moved) noexcept;
+                constexpr Flags(Flags&& moved) noexcept :
+                    m_bits(moved.m_bits)
+                {
+
+                }
 
                 /**
                  * @brief Copy constructor.
                  * @param flags Copy.
                  */
-                Flags(const Flags& flags);
+                constexpr Flags(const Flags& flags) :
+                    m_bits(flags.m_bits)
+                {
+
+                }
 
                 /**
                  * @brief Method for setting bit value.
@@ -86,19 +120,29 @@ namespace Diameter
                  * @param bit Bit.
                  * @return Value.
                  */
-                bool isSet(Bits bit) const;
+                constexpr bool isSet(Bits bit) const
+                {
+                    return (m_bits & static_cast<Type>(bit)) == static_cast<Type>(bit);
+                }
 
                 /**
                  * @brief Method for validating flags. eg. RFC-3588.
+                 * Lower 4 bits are reserved.
                  * @return Is valid.
                  */
-                bool isValid() const;
+                constexpr bool isValid() const
+                {
+                    return (m_bits & 0x0F) == 0; // 0b00001111
+                }
 
                 /**
                  * @brief Method for getting flags serialized.
                  * @return Serialized.
                  */
-                Type deploy() const;
+                constexpr Type deploy() const
+                {
+                    return m_bits;
+                }
 
                 /**
                  * @brief Move operator.
@@ -129,6 +173,17 @@ namespace Diameter
              */
             explicit Header(const ByteArray& array);
 
+            /**
+             * @brief Method for decoding header straight
+             * from serialized packet. It does not allocate
+             * and does not validate fields.
+             * @param data Pointer to first byte of packet.
+             * @param size Number of available bytes.
+             * @param header Result header. It's untouched on failure.
+             * @return false if data is smaller than header.
+             */
+            static bool peek(const uint8_t* data, std::size_t size, Header& header);
+
             /**
              * @brief Move constructor.
              * @param moved Moved element.
@@ -316,6 +371,14 @@ namespace Diameter
              */
             void deploy(ByteArray& byteArray) const;
 
+            /**
+             * @brief Method for deploying header to raw
+             * memory. Size bytes are written.
+             * @param data Pointer to destination.
+             * @return Pointer past written bytes.
+             */
+            uint8_t* deploy(uint8_t* data) const;
+
         private:
             VersionType m_version;
             MessageLengthType m_messageLength;
@@ -331,12 +394,90 @@ namespace Diameter
          */
         Packet();
 
+        /**
+         * @brief Constructor. AVP list, lookup index,
+         * lazy parsing copy of packet and values of parsed
+         * AVPs are allocated from arena. Packet has to be
+         * destroyed before arena reset. Packet keeps arena
+         * on parsing with tryParse, so arena backed packet
+         * does not allocate from heap, except for wire
+         * bytes of memoized AVPs. AVPs, added by addAVP,
+         * keep their own memory. Copies of packet do not
+         * use arena.
+         * @param arena Arena.
+         */
+        explicit Packet(Arena& arena);
+
         /**
          * @brief Parsing constructor.
          * @param byteArray Byte array.
          */
         explicit Packet(const ByteArray& byteArray);
 
+        /**
+         * @brief Parsing constructor.
+         * In lazy mode byte array is copied once and
+         * AVPs are walked once to record their offsets.
+         * AVP objects are decoded from that copy on access.
+         * If AVPs are malformed, std::invalid_argument
+         * exception will be thrown.
+         * @param byteArray Byte array.
+         * @param mode Parsing mode.
+         */
+        Packet(const ByteArray& byteArray, ParseMode mode);
+
+        /**
+         * @brief Exception-free parsing method.
+         * Whole packet is validated before packet object
+         * is touched, so failure path does not throw
+         * and does not allocate. Storage of packet is
+         * reused: in eager and memoized modes previous
+         * AVP objects are overwritten in place, so their
+         * buffers are reused too.
+         * @param data Pointer to first byte of packet.
+         * @param size Packet size in bytes.
+         * @param packet Result packet. It's untouched on failure.
+         * @param mode Parsing mode.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult tryParse(const uint8_t* data,
+                                    std::size_t size,
+                                    Packet& packet,
+                                    ParseMode mode=ParseMode::Eager);
+
+        /**
+         * @brief Selective parsing constructor.
+         * Only AVPs from interest set are decoded.
+         * Other AVPs are skipped by length field and
+         * kept as raw bytes, so packet deploys them
+         * untouched. They are decoded on access as in
+         * lazy mode. If AVPs are malformed,
+         * std::invalid_argument exception will be thrown.
+         * @param byteArray Byte array.
+         * @param interests AVPs, that have to be decoded.
+         */
+        Packet(const ByteArray& byteArray, const InterestSet& interests);
+
+        /**
+         * @brief Exception-free selective parsing method.
+         * @param data Pointer to first byte of packet.
+         * @param size Packet size in bytes.
+         * @param packet Result packet. It's untouched on failure.
+         * @param interests AVPs, that have to be decoded.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult tryParse(const uint8_t* data,
+                                    std::size_t size,
+                                    Packet& packet,
+                                    const InterestSet& interests);
+
+        /**
+         * @brief Constructor from already validated view.
+         * @param view Packet view.
+         * @param mode Parsing mode.
+         */
+        explicit Packet(const PacketView& view, ParseMode mode=ParseMode::Eager);
+
         /**
          * @brief Move constructor.
          * @param moved Move constructor.
@@ -349,6 +490,16 @@ namespace Diameter
          */
         Packet(const Packet& packet);
 
+        /**
+         * @brief Method for making packet empty, as
+         * default constructed one. AVP objects are kept
+         * with their value buffers, as well as capacity
+         * of lookup index, so parsing into packet again
+         * does not allocate.
+         * @return Reference to constructor.
+         */
+        Packet& reset();
+
         /**
          * @brief Method for setting diameter packet header.
          * @param header Packet header.
@@ -389,7 +540,10 @@ namespace Diameter
          * @brief Method for getting AVP by index.
          * If there is no AVP with this index,
          * std::invalid_argument exception will be
-         * thrown.
+         * thrown. AVP may be changed through reference
+         * until next updateLength(), AVP insertion,
+         * replacing, erasing, parsing or reset. Length of
+         * such AVPs is summed on calculateLength() until then.
          * @param index Index.
          * @return AVP.
          */
@@ -416,6 +570,53 @@ namespace Diameter
          */
         uint32_t numberOfAVPs() const;
 
+        /**
+         * @brief Method for finding first AVP with
+         * code and vendor id. Lookup is done by index,
+         * sorted by code and vendor id. AVPs, accessed
+         * through mutable reference since last
+         * updateLength(), are checked one by one.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return AVP index or NoAVP if there is no such AVP.
+         */
+        uint32_t find(AVP::Header::AVPCodeType code,
+                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for finding all AVPs with
+         * code and vendor id.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return Ascending AVP indices.
+         */
+        std::vector<uint32_t> findAll(AVP::Header::AVPCodeType code,
+                                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for checking is there AVP
+         * with code and vendor id.
+         * @param code AVP code.
+         * @param vendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         * @return Is there such AVP.
+         */
+        bool contains(AVP::Header::AVPCodeType code,
+                      AVP::Header::VendorIdType vendorId=0) const;
+
+        /**
+         * @brief Method for checking is AVP already decoded.
+         * AVPs of packets, parsed in eager mode or added
+         * manually, are always decoded. If there is
+         * no AVP with this index, std::invalid_argument
+         * exception will be thrown.
+         * @param index AVP index.
+         * @return Is AVP decoded.
+         */
+        bool isMaterialized(uint32_t index) const;
+
         /**
          * @brief Method for checking is packet valid.
          * @return Packet validness.
@@ -444,16 +645,25 @@ namespace Diameter
 
         /**
          * @brief Method for calculating actual packet length.
+         * Length is kept up to date by AVP insertion, replacing
+         * and erasing. Only AVPs, that were accessed through
+         * mutable reference since last updateLength(), are
+         * walked.
          * @return Actual packet length.
          */
         Header::MessageLengthType calculateLength() const;
 
         /**
          * @brief Method for updating length in header.
+         * Length of AVPs, accessed through mutable reference,
+         * is taken into cached length, so these references
+         * can't be used for changing AVPs anymore.
          * @return Reference to constructor.
          */
         Packet& updateLength();
 
+        const static uint32_t NoAVP = UINT32_MAX; //< Result of failed AVP lookup
+
         /**
          * @brief Method for deploying packet as byte array.
          * Packet will be appended to deploy.
@@ -461,11 +671,194 @@ namespace Diameter
          */
         void deploy(ByteArray& byteArray, bool checkValid=true) const;
 
+        /**
+         * @brief Method for deploying packet to raw
+         * memory. calculateLength() bytes are written.
+         * Packet is not validated. If AVPs do not fill
+         * calculated length exactly, std::logic_error
+         * exception will be thrown.
+         * @param data Pointer to destination.
+         * @return Pointer past written bytes.
+         */
+        uint8_t* deploy(uint8_t* data) const;
+
+        /**
+         * @brief Method for deploying packet as list of
+         * segments for scatter-gather output. Values, that
+         * are not smaller than list threshold, are referenced
+         * in place instead of copying, so segments are valid
+         * until packet is modified.
+         * @param segments Segment list. Previous segments are dropped.
+         * @param checkValid Validate packet before deploying.
+         */
+        void deploy(SegmentList& segments, bool checkValid=true) const;
+
     private:
+        friend class BatchEncoder;
+        friend class PacketPool;
+
+        // Containers, that may take memory from arena
+        template<typename T>
+        using Storage = std::vector<T, ArenaAllocator<T>>;
+
+        /**
+         * @brief Method for filling packet from validated view.
+         * @param view Packet view.
+         * @param mode Parsing mode.
+         * @param interests AVPs, that are decoded right away
+         * in lazy mode. May be nullptr.
+         */
+        void assign(const PacketView& view, ParseMode mode, const InterestSet* interests=nullptr);
+
+        /**
+         * @brief Method for setting number of AVPs before
+         * they are overwritten by parsing. Kept AVPs are
+         * reused, missing ones use arena of packet.
+         * @param size Number of AVPs.
+         */
+        void reserveAVPs(uint32_t size);
+
+        /**
+         * @brief Method for decoding AVP, that was left
+         * raw by lazy parsing.
+         * @param index AVP index.
+         */
+        void materialize(uint32_t index);
+
+        /**
+         * @brief Method for checking is AVP decoded
+         * without index check.
+         * @param index AVP index.
+         * @return Is AVP decoded.
+         */
+        bool isDecoded(uint32_t index) const;
+
+        /**
+         * @brief Method for getting view of raw AVP.
+         * @param index AVP index. AVP must not be materialized.
+         * @return AVP view.
+         */
+        AVPView rawAVP(uint32_t index) const;
+
+        /**
+         * @brief Method for getting padded length of AVP.
+         * @param index AVP index.
+         * @return Padded AVP length.
+         */
+        Header::MessageLengthType paddedLength(uint32_t index) const;
+
+        /**
+         * @brief Method for excluding AVP from cached length,
+         * because it may be changed through reference.
+         * @param index AVP index.
+         */
+        void expose(uint32_t index);
+
+        /**
+         * @brief Method for taking length of exposed
+         * AVPs into cached length.
+         */
+        void settle();
+
+        /**
+         * @brief Method for writing packet to raw memory.
+         * @param data Pointer to destination.
+         * @param end Pointer past destination.
+         * @param checkValid Validate AVPs while writing.
+         * @return Pointer past written bytes or nullptr
+         * if invalid AVP was met or packet does not fit.
+         */
+        uint8_t* write(uint8_t* data, const uint8_t* end, bool checkValid) const;
+
+        /**
+         * @brief Lookup index entry.
+         */
+        struct IndexEntry
+        {
+            AVP::Header::AVPCodeType code;
+            AVP::Header::VendorIdType vendorId;
+            uint32_t index;
+
+            bool operator<(const IndexEntry& rhs) const;
+        };
+
+        /**
+         * @brief Method for getting lookup key of AVP.
+         * @param index AVP index.
+         * @return Index entry.
+         */
+        IndexEntry indexEntry(uint32_t index) const;
+
+        /**
+         * @brief Method for checking key of AVP, that
+         * is left out of lookup index.
+         * @param index AVP index.
+         * @param code AVP code.
+         * @param vendorId Vendor id.
+         * @return Does AVP have this code and vendor id.
+         */
+        bool isExposedMatch(uint32_t index,
+                            AVP::Header::AVPCodeType code,
+                            AVP::Header::VendorIdType vendorId) const;
+
+        /**
+         * @brief Method for building lookup index
+         * from scratch.
+         */
+        void buildIndex();
+
+        /**
+         * @brief Method for adding AVP to lookup index.
+         * @param index AVP index.
+         */
+        void indexAVP(uint32_t index);
+
+        /**
+         * @brief Method for removing AVP from lookup index.
+         * @param index AVP index.
+         * @param shift Shift indices of next AVPs.
+         */
+        void unindexAVP(uint32_t index, bool shift);
+
+        /**
+         * @brief Method for getting range of lookup
+         * index entries with code and vendor id.
+         * @param code AVP code.
+         * @param vendorId Vendor id.
+         * @return Range.
+         */
+        std::pair<
+            Storage<IndexEntry>::const_iterator,
+            Storage<IndexEntry>::const_iterator
+        > lookup(AVP::Header::AVPCodeType code,
+                 AVP::Header::VendorIdType vendorId) const;
 
         Header m_header;
 
-        std::vector<AVP> m_avps;
+        // AVPs past m_size were reset or erased. They
+        // are kept, so parsing reuses their buffers.
+        Storage<AVP> m_avps;
+        uint32_t m_size;
+
+        // Lazy parsing state. Source is a copy of
+        // parsed packet. Offset of AVP in source is
+        // 0 if AVP is already decoded into m_avps.
+        Storage<uint8_t> m_source;
+        Storage<uint32_t> m_offsets;
+
+        // Lookup index, sorted by code, vendor id and
+        // AVP index. It's changed only by non-const methods,
+        // so const lookups are safe from several threads.
+        Storage<IndexEntry> m_index;
+
+        // Cached packet length does not include exposed
+        // AVPs and their lookup index entries are skipped.
+        // Exposed AVPs were handed out by mutable reference,
+        // so they may be changed without packet noticing.
+        // Flag is set for each exposed AVP index.
+        Header::MessageLengthType m_length;
+        Storage<uint32_t> m_exposed;
+        Storage<uint8_t> m_exposedFlags;
     };
 }
 
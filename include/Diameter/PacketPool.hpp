@@ -0,0 +1,89 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Packet.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Pool of empty packets, that keep capacity
+     * of their storage. Worker takes packet, parses
+     * message into it and gives it back, so in steady
+     * state parsing does not touch global allocator
+     * for packet storage.
+     *
+     * Pool is not thread safe. Every thread may use its
+     * own pool, returned by local().
+     *
+     * Usage:
+     * @code
+     * auto& pool = Diameter::PacketPool::local();
+     *
+     * auto packet = pool.acquire();
+     *
+     * Diameter::Packet::tryParse(data, size, packet);
+     *
+     * handle(packet);
+     *
+     * pool.release(std::move(packet));
+     * @endcode
+     */
+    class PacketPool
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param capacity Maximum number of kept packets.
+         */
+        explicit PacketPool(std::size_t capacity=64);
+
+        /**
+         * @brief Method for getting pool of current thread.
+         * @return Pool.
+         */
+        static PacketPool& local();
+
+        /**
+         * @brief Method for taking empty packet from pool.
+         * If pool is empty, new packet is returned.
+         * @return Packet.
+         */
+        Packet acquire();
+
+        /**
+         * @brief Method for giving packet back to pool.
+         * Packet is reset. If pool is full or packet
+         * uses arena, packet is not kept.
+         * @param packet Packet.
+         */
+        void release(Packet&& packet);
+
+        /**
+         * @brief Method for getting number of kept packets.
+         * @return Number of packets.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Method for getting maximum number
+         * of kept packets.
+         * @return Number of packets.
+         */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Method for destroying kept packets.
+         */
+        void clear();
+
+    private:
+        std::vector<Packet> m_packets;
+        std::size_t m_capacity;
+    };
+}
@@ -0,0 +1,170 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "AVPView.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Read-only view of serialized Diameter packet.
+     * It does not own or copy memory, it points into
+     * caller-owned buffer, that has to outlive the view.
+     * Header fields and AVPs are decoded on access.
+     */
+    class PacketView
+    {
+    public:
+
+        /**
+         * @brief Default constructor. Creates empty view.
+         */
+        PacketView();
+
+        /**
+         * @brief Parsing constructor. Walks AVP headers once
+         * to check that every AVP fits into buffer. If it's
+         * not, std::invalid_argument exception will be thrown.
+         * @param data Pointer to first byte of packet.
+         * @param size Packet size in bytes.
+         */
+        PacketView(const uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Parsing constructor.
+         * @param byteArray Byte array. Has to outlive the view.
+         */
+        explicit PacketView(const ByteArray& byteArray);
+
+        /**
+         * @brief Exception-free parsing method. Performs the
+         * same checks as parsing constructor, but reports
+         * failure with result instead of exception.
+         * @param data Pointer to first byte of packet.
+         * @param size Packet size in bytes.
+         * @param view Result view. It's untouched on failure.
+         * @return Parsing result. Offset is relative to data.
+         */
+        static ParseResult tryParse(const uint8_t* data, std::size_t size, PacketView& view);
+
+        /**
+         * @brief Method for decoding packet header.
+         * @return Header.
+         */
+        Packet::Header header() const;
+
+        /**
+         * @brief Method for getting diameter packet version.
+         * @return Version.
+         */
+        Packet::Header::VersionType version() const;
+
+        /**
+         * @brief Method for getting message length from header.
+         * @return Message length in bytes.
+         */
+        Packet::Header::MessageLengthType messageLength() const;
+
+        /**
+         * @brief Method for getting command flags.
+         * @return Flags.
+         */
+        Packet::Header::Flags commandFlags() const;
+
+        /**
+         * @brief Method for getting command code.
+         * @return Command code.
+         */
+        Packet::Header::CommandCodeType commandCode() const;
+
+        /**
+         * @brief Method for getting ApplicationId.
+         * @return ApplicationId.
+         */
+        Packet::Header::ApplicationIdType applicationId() const;
+
+        /**
+         * @brief Method for getting Hop-By-Hop identifier.
+         * @return Hop-By-Hop value.
+         */
+        Packet::Header::HBHType hbhIdentifier() const;
+
+        /**
+         * @brief Method for getting End-To-End identifier.
+         * @return End-To-End value.
+         */
+        Packet::Header::ETEType eteIdentifier() const;
+
+        /**
+         * @brief Method for getting AVP view by index.
+         * AVPs are walked from the beginning.
+         * If there is no AVP with this index,
+         * std::invalid_argument exception will be
+         * thrown.
+         * @param index Index.
+         * @return AVP view.
+         */
+        AVPView avp(uint32_t index) const;
+
+        /**
+         * @brief Method for getting number of AVPs.
+         * @return Number of AVPs.
+         */
+        uint32_t numberOfAVPs() const;
+
+        /**
+         * @brief Method for getting iterator to first AVP.
+         * @return Iterator.
+         */
+        AVPView::Iterator begin() const;
+
+        /**
+         * @brief Method for getting iterator past last AVP.
+         * @return Iterator.
+         */
+        AVPView::Iterator end() const;
+
+        /**
+         * @brief Method for getting pointer to first
+         * byte of packet.
+         * @return Pointer.
+         */
+        const uint8_t* data() const;
+
+        /**
+         * @brief Method for getting packet size in bytes.
+         * @return Size.
+         */
+        uint32_t size() const;
+
+        /**
+         * @brief Method for checking is view empty.
+         * @return Is empty.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Method for checking is packet valid.
+         * @return Packet validness.
+         */
+        bool isValid() const;
+
+        /**
+         * @brief Method for building packet object
+         * from view. AVP values will be copied.
+         * @return Packet.
+         */
+        Packet toPacket() const;
+
+    private:
+        const uint8_t* m_data;
+        uint32_t m_size;
+        uint32_t m_numberOfAVPs;
+    };
+}
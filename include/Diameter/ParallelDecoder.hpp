@@ -0,0 +1,152 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "ParseResult.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Class for decoding large batches of stored
+     * messages on several threads.
+     *
+     * Worker threads are started once and reused for
+     * every batch. Batch is split into equal ranges, one
+     * per thread. Thread claims small chunks of its own
+     * range and, when it's exhausted, steals chunks from
+     * ranges of other threads. Calling thread takes part
+     * in decoding too.
+     *
+     * Packet and result of every message are written by
+     * message index, so output keeps input order.
+     */
+    class ParallelDecoder
+    {
+    public:
+
+        /**
+         * @brief Message buffer. Has to stay valid
+         * during decoding.
+         */
+        struct Message
+        {
+            const uint8_t* data;
+            std::size_t size;
+        };
+
+        /**
+         * @brief Constructor. Starts worker threads.
+         * If number of threads is 0, std::invalid_argument
+         * exception will be thrown.
+         * @param numberOfThreads Number of decoding threads,
+         * including calling thread.
+         */
+        explicit ParallelDecoder(uint32_t numberOfThreads=std::max(1u, std::thread::hardware_concurrency()));
+
+        /**
+         * @brief Destructor. Stops worker threads.
+         */
+        ~ParallelDecoder();
+
+        ParallelDecoder(const ParallelDecoder&) = delete;
+        ParallelDecoder& operator=(const ParallelDecoder&) = delete;
+
+        /**
+         * @brief Method for decoding batch of messages.
+         * Blocks until every message is decoded.
+         * @param messages Message buffers.
+         * @param packets Packets. Resized to number of messages.
+         * Packet of failed message is left default.
+         * @param results Parsing results. Resized to number of messages.
+         * @param mode Parsing mode.
+         */
+        void decode(const std::vector<Message>& messages,
+                    std::vector<Packet>& packets,
+                    std::vector<ParseResult>& results,
+                    Packet::ParseMode mode=Packet::ParseMode::Eager);
+
+        /**
+         * @brief Method for decoding batch of messages.
+         * @param messages Message buffers.
+         * @param packets Packets. Resized to number of messages.
+         * @param results Parsing results. Resized to number of messages.
+         * @param mode Parsing mode.
+         */
+        void decode(const std::vector<ByteArray>& messages,
+                    std::vector<Packet>& packets,
+                    std::vector<ParseResult>& results,
+                    Packet::ParseMode mode=Packet::ParseMode::Eager);
+
+        /**
+         * @brief Method for getting number of decoding
+         * threads, including calling thread.
+         * @return Number of threads.
+         */
+        uint32_t numberOfThreads() const;
+
+    private:
+
+        const static std::size_t ChunkSize = 16; //< Number of messages, claimed at once
+
+        /**
+         * @brief Range of message indices, owned by one thread.
+         * Aligned to cache line to avoid false sharing of counters.
+         */
+        struct alignas(64) Range
+        {
+            std::atomic<std::size_t> next;
+            std::size_t end;
+        };
+
+        /**
+         * @brief Method, executed by every worker thread.
+         * @param index Thread index.
+         */
+        void workerLoop(uint32_t index);
+
+        /**
+         * @brief Method for decoding messages of current
+         * batch. Own range first, then stealing.
+         * @param index Thread index.
+         */
+        void run(uint32_t index);
+
+        /**
+         * @brief Method for decoding chunks of range
+         * until it's exhausted.
+         * @param range Range.
+         */
+        void drain(Range& range);
+
+        uint32_t m_numberOfThreads;
+        std::unique_ptr<uint8_t[]> m_rangeStorage;
+        Range* m_ranges;
+        std::vector<std::thread> m_threads;
+
+        // Current batch
+        const Message* m_messages;
+        Packet* m_packets;
+        ParseResult* m_results;
+        Packet::ParseMode m_mode;
+
+        std::mutex m_mutex;
+        std::condition_variable m_startCondition;
+        std::condition_variable m_finishCondition;
+        uint64_t m_generation;
+        uint32_t m_running;
+        bool m_stop;
+    };
+}
@@ -0,0 +1,95 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace Diameter
+{
+    /**
+     * @brief Result of exception-free parsing.
+     * It's trivially copyable and never allocates,
+     * so it can be returned on malformed input paths.
+     */
+    class ParseResult
+    {
+    public:
+
+        /**
+         * @brief Parsing result code.
+         */
+        enum class Code
+        {
+              Ok                //< Parsing succeeded.
+            , HeaderTooSmall    //< Data is smaller than packet header.
+            , AVPHeaderTooSmall //< Data is smaller than AVP header.
+            , AVPLengthTooSmall //< AVP length field is smaller than AVP header.
+            , AVPLengthTooLarge //< AVP does not fit into data.
+            , InvalidVersion    //< Packet version is not 1.
+            , InvalidFlags      //< Reserved packet flag bits are set.
+            , InvalidLength     //< Message length is smaller than packet header.
+            , SchemaMismatch    //< Message does not match schema.
+        };
+
+        /**
+         * @brief Default constructor. Creates successful result.
+         */
+        ParseResult();
+
+        /**
+         * @brief Constructor.
+         * @param code Result code.
+         * @param offset Offset of failed element in bytes.
+         * @param avpCode Code of failed AVP or 0 if it's unknown.
+         */
+        ParseResult(Code code, uint32_t offset, uint32_t avpCode);
+
+        /**
+         * @brief Method for getting result code.
+         * @return Result code.
+         */
+        Code code() const;
+
+        /**
+         * @brief Method for getting offset of failed element
+         * from the beginning of parsed data.
+         * @return Offset in bytes.
+         */
+        uint32_t offset() const;
+
+        /**
+         * @brief Method for getting code of AVP, that
+         * failed parsing. It's 0 if code can't be read.
+         * @return AVP code.
+         */
+        uint32_t avpCode() const;
+
+        /**
+         * @brief Method for checking is parsing succeeded.
+         * @return Is succeeded.
+         */
+        bool isOk() const;
+
+        /**
+         * @brief Method for getting static error description.
+         * @return Null-terminated description.
+         */
+        const char* message() const;
+
+        /**
+         * @brief Method for getting the same result with
+         * offset shifted. Used for reporting errors of nested
+         * elements relative to outer element.
+         * @param offset Offset of nested element.
+         * @return Shifted result.
+         */
+        ParseResult shifted(uint32_t offset) const;
+
+    private:
+        Code m_code;
+        uint32_t m_offset;
+        uint32_t m_avpCode;
+    };
+}
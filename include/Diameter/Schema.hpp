@@ -0,0 +1,664 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <ByteArray.hpp>
+#include "Packet.hpp"
+#include "AVP.hpp"
+#include "ParseResult.hpp"
+#include "Wire.hpp"
+#include "Exceptions.hpp"
+
+namespace Diameter
+{
+    /**
+     * @brief Compile time message schemas.
+     *
+     * Message of fixed shape (command and ordered list of
+     * AVPs) is described with templates. Header words, AVP
+     * header words and lengths of fixed size AVPs are
+     * computed at compile time, so encoding is writing of
+     * constants and values and decoding is comparing
+     * of constants and reading of values.
+     *
+     * Usage:
+     * @code
+     * // Device-Watchdog-Request
+     * using DWR = Diameter::Schema::Message<
+     *     280,
+     *     static_cast<uint8_t>(Diameter::Packet::Header::Flags::Bits::Request),
+     *     0,
+     *     Diameter::Schema::Field<264, Diameter::Schema::Type::OctetString>, // Origin-Host
+     *     Diameter::Schema::Field<296, Diameter::Schema::Type::OctetString>, // Origin-Realm
+     *     Diameter::Schema::Field<278, Diameter::Schema::Type::Unsigned32>   // Origin-State-Id
+     * >;
+     *
+     * ByteArray message;
+     * DWR::encode(DWR::Values(host, realm, 1), hbh, ete, message);
+     *
+     * DWR::Values values;
+     * auto result = DWR::decode(message.data(), message.size(), values);
+     * @endcode
+     */
+    namespace Schema
+    {
+        /**
+         * @brief AVP value types.
+         */
+        enum class Type
+        {
+              OctetString
+            , Integer32
+            , Integer64
+            , Unsigned32
+            , Unsigned64
+        };
+
+        /**
+         * @brief Octet string value. Points to external
+         * memory (eg. decoded message), that has to outlive it.
+         */
+        class Octets
+        {
+        public:
+
+            /**
+             * @brief Default constructor. Creates empty value.
+             */
+            Octets();
+
+            /**
+             * @brief Constructor.
+             * @param data Pointer to value.
+             * @param size Value size.
+             */
+            Octets(const uint8_t* data, std::size_t size);
+
+            /**
+             * @brief Constructor. Byte array has to stay
+             * valid while value is used.
+             * @param value Value.
+             */
+            explicit Octets(const ByteArray& value);
+
+            // Value would point into destroyed temporary
+            Octets(ByteArray&&) = delete;
+
+            /**
+             * @brief Method for getting pointer to value.
+             * @return Pointer to value.
+             */
+            const uint8_t* data() const;
+
+            /**
+             * @brief Method for getting value size.
+             * @return Value size.
+             */
+            std::size_t size() const;
+
+            /**
+             * @brief Method for copying value to byte array.
+             * @return Byte array.
+             */
+            ByteArray toByteArray() const;
+
+        private:
+            const uint8_t* m_data;
+            std::size_t m_size;
+        };
+
+        /**
+         * @brief Value encoding of AVP type.
+         * @tparam Kind Value type.
+         */
+        template<Type Kind>
+        struct Value;
+
+        template<>
+        struct Value<Type::OctetString>
+        {
+            using ValueType = Octets;
+
+            static constexpr uint32_t fixedSize()
+            {
+                return 0;
+            }
+
+            static uint32_t size(const ValueType& value)
+            {
+                return static_cast<uint32_t>(value.size());
+            }
+
+            static void write(uint8_t* data, const ValueType& value)
+            {
+                if (value.size() != 0)
+                {
+                    std::memcpy(data, value.data(), value.size());
+                }
+            }
+
+            static void read(const uint8_t* data, uint32_t size, ValueType& value)
+            {
+                value = Octets(data, size);
+            }
+        };
+
+        template<>
+        struct Value<Type::Integer32>
+        {
+            using ValueType = int32_t;
+
+            static constexpr uint32_t fixedSize()
+            {
+                return sizeof(ValueType);
+            }
+
+            static uint32_t size(const ValueType&)
+            {
+                return fixedSize();
+            }
+
+            static void write(uint8_t* data, const ValueType& value)
+            {
+                Wire::writeUInt32(data, static_cast<uint32_t>(value));
+            }
+
+            static void read(const uint8_t* data, uint32_t, ValueType& value)
+            {
+                value = static_cast<ValueType>(Wire::readUInt32(data));
+            }
+        };
+
+        template<>
+        struct Value<Type::Integer64>
+        {
+            using ValueType = int64_t;
+
+            static constexpr uint32_t fixedSize()
+            {
+                return sizeof(ValueType);
+            }
+
+            static uint32_t size(const ValueType&)
+            {
+                return fixedSize();
+            }
+
+            static void write(uint8_t* data, const ValueType& value)
+            {
+                Wire::writeUInt64(data, static_cast<uint64_t>(value));
+            }
+
+            static void read(const uint8_t* data, uint32_t, ValueType& value)
+            {
+                value = static_cast<ValueType>(Wire::readUInt64(data));
+            }
+        };
+
+        template<>
+        struct Value<Type::Unsigned32>
+        {
+            using ValueType = uint32_t;
+
+            static constexpr uint32_t fixedSize()
+            {
+                return sizeof(ValueType);
+            }
+
+            static uint32_t size(const ValueType&)
+            {
+                return fixedSize();
+            }
+
+            static void write(uint8_t* data, const ValueType& value)
+            {
+                Wire::writeUInt32(data, value);
+            }
+
+            static void read(const uint8_t* data, uint32_t, ValueType& value)
+            {
+                value = Wire::readUInt32(data);
+            }
+        };
+
+        template<>
+        struct Value<Type::Unsigned64>
+        {
+            using ValueType = uint64_t;
+
+            static constexpr uint32_t fixedSize()
+            {
+                return sizeof(ValueType);
+            }
+
+            static uint32_t size(const ValueType&)
+            {
+                return fixedSize();
+            }
+
+            static void write(uint8_t* data, const ValueType& value)
+            {
+                Wire::writeUInt64(data, value);
+            }
+
+            static void read(const uint8_t* data, uint32_t, ValueType& value)
+            {
+                value = Wire::readUInt64(data);
+            }
+        };
+
+        /**
+         * @brief AVP of schema. Vendor specific bit is set
+         * from vendor id.
+         * @tparam Code AVP code.
+         * @tparam Kind Value type.
+         * @tparam Flags AVP flags. Mandatory by default.
+         * @tparam VendorId Vendor id. 0 for AVPs without
+         * vendor specific bit.
+         */
+        template<AVP::Header::AVPCodeType Code,
+                 Type Kind,
+                 AVP::Header::Flags::Type Flags=static_cast<AVP::Header::Flags::Type>(AVP::Header::Flags::Bits::Mandatory),
+                 AVP::Header::VendorIdType VendorId=0>
+        struct Field
+        {
+            static_assert(AVP::Header::Flags(Flags).isValid(),
+                          "Reserved AVP flag bits are set.");
+
+            static_assert(!AVP::Header::Flags(Flags).isSet(AVP::Header::Flags::Bits::VendorSpecific),
+                          "Vendor specific bit is set from vendor id.");
+
+            using Traits = Value<Kind>;
+            using ValueType = typename Traits::ValueType;
+
+            static constexpr AVP::Header::AVPCodeType code()
+            {
+                return Code;
+            }
+
+            static constexpr AVP::Header::VendorIdType vendorId()
+            {
+                return VendorId;
+            }
+
+            static constexpr AVP::Header::Flags::Type flags()
+            {
+                return VendorId != 0 ?
+                       static_cast<AVP::Header::Flags::Type>(Flags | static_cast<AVP::Header::Flags::Type>(AVP::Header::Flags::Bits::VendorSpecific)) :
+                       Flags;
+            }
+
+            static constexpr uint32_t headerSize()
+            {
+                return VendorId != 0 ?
+                       static_cast<uint32_t>(AVP::Header::MaxSize) :
+                       static_cast<uint32_t>(AVP::Header::MinSize);
+            }
+
+            static constexpr bool isFixed()
+            {
+                return Traits::fixedSize() != 0;
+            }
+
+            /**
+             * @brief Padded length. For octet strings
+             * it's length with empty value.
+             */
+            static constexpr uint32_t minimumLength()
+            {
+                return Wire::padded(headerSize() + Traits::fixedSize());
+            }
+
+            /**
+             * @brief First 8 header bytes: code, flags and
+             * length. Length is 0 for octet strings.
+             */
+            static constexpr uint64_t headerWord()
+            {
+                return (static_cast<uint64_t>(Code) << 32) |
+                       (static_cast<uint64_t>(flags()) << 24) |
+                       (isFixed() ? headerSize() + Traits::fixedSize() : 0);
+            }
+
+            static uint32_t length(const ValueType& value)
+            {
+                return headerSize() + Traits::size(value);
+            }
+        };
+
+        /**
+         * @brief Encoder and decoder of AVP sequence.
+         * Unrolled at compile time.
+         * @tparam Index Index of first field in values tuple.
+         * @tparam Fields Fields.
+         */
+        template<std::size_t Index, typename... Fields>
+        struct FieldList;
+
+        template<std::size_t Index>
+        struct FieldList<Index>
+        {
+            static constexpr bool isFixed()
+            {
+                return true;
+            }
+
+            static constexpr uint32_t minimumLength()
+            {
+                return 0;
+            }
+
+            template<typename Values>
+            static uint32_t length(const Values&)
+            {
+                return 0;
+            }
+
+            template<typename Values>
+            static uint8_t* encode(const Values&, uint8_t* data)
+            {
+                return data;
+            }
+
+            template<bool Checked, typename Values>
+            static ParseResult decode(const uint8_t*, uint32_t&, uint32_t, Values&)
+            {
+                return ParseResult();
+            }
+        };
+
+        template<std::size_t Index, typename Current, typename... Rest>
+        struct FieldList<Index, Current, Rest...>
+        {
+            using Next = FieldList<Index + 1, Rest...>;
+
+            static constexpr bool isFixed()
+            {
+                return Current::isFixed() && Next::isFixed();
+            }
+
+            static constexpr uint32_t minimumLength()
+            {
+                return Current::minimumLength() + Next::minimumLength();
+            }
+
+            template<typename Values>
+            static uint32_t length(const Values& values)
+            {
+                return Wire::padded(Current::length(std::get<Index>(values))) + Next::length(values);
+            }
+
+            template<typename Values>
+            static uint8_t* encode(const Values& values, uint8_t* data)
+            {
+                auto& value = std::get<Index>(values);
+
+                auto length = Current::length(value);
+
+                Wire::writeUInt64(data, Current::isFixed() ? Current::headerWord() : Current::headerWord() | length);
+
+                if (Current::vendorId() != 0)
+                {
+                    Wire::writeUInt32(data + AVP::Header::MinSize, Current::vendorId());
+                }
+
+                Current::Traits::write(data + Current::headerSize(), value);
+
+                // Fixed size values are 4 or 8 bytes
+                if (!Current::isFixed())
+                {
+                    std::memset(data + length, 0, Wire::padded(length) - length);
+                }
+
+                return Next::encode(values, data + Wire::padded(length));
+            }
+
+            /**
+             * @tparam Checked Should sizes be checked. Sizes of
+             * fixed messages are checked once by message length.
+             */
+            template<bool Checked, typename Values>
+            static ParseResult decode(const uint8_t* data, uint32_t& pointer, uint32_t size, Values& values)
+            {
+                if (Checked && size - pointer < Current::headerSize())
+                {
+                    return ParseResult(ParseResult::Code::AVPHeaderTooSmall, pointer, Current::code());
+                }
+
+                auto word = Wire::readUInt64(data + pointer);
+
+                if ((Current::isFixed() ? word : word & ~static_cast<uint64_t>(0xFFFFFF)) != Current::headerWord())
+                {
+                    return ParseResult(ParseResult::Code::SchemaMismatch, pointer, Current::code());
+                }
+
+                if (Current::vendorId() != 0 &&
+                    Wire::readUInt32(data + pointer + AVP::Header::MinSize) != Current::vendorId())
+                {
+                    return ParseResult(ParseResult::Code::SchemaMismatch, pointer, Current::code());
+                }
+
+                auto length = static_cast<uint32_t>(word & 0xFFFFFF);
+
+                if (!Current::isFixed() && length < Current::headerSize())
+                {
+                    return ParseResult(ParseResult::Code::AVPLengthTooSmall, pointer, Current::code());
+                }
+
+                if (Checked && Wire::padded(length) > size - pointer)
+                {
+                    return ParseResult(ParseResult::Code::AVPLengthTooLarge, pointer, Current::code());
+                }
+
+                Current::Traits::read(
+                    data + pointer + Current::headerSize(),
+                    length - Current::headerSize(),
+                    std::get<Index>(values)
+                );
+
+                pointer += Wire::padded(length);
+
+                return Next::template decode<Checked>(data, pointer, size, values);
+            }
+        };
+
+        /**
+         * @brief Message schema.
+         * @tparam CommandCode Command code.
+         * @tparam CommandFlags Command flags.
+         * @tparam ApplicationId Application id.
+         * @tparam Fields AVPs in message order.
+         */
+        template<Packet::Header::CommandCodeType CommandCode,
+                 Packet::Header::Flags::Type CommandFlags,
+                 Packet::Header::ApplicationIdType ApplicationId,
+                 typename... Fields>
+        class Message
+        {
+            static_assert(CommandCode <= 0xFFFFFF,
+                          "Command code does not fit into 24 bits.");
+
+            static_assert(Packet::Header::Flags(CommandFlags).isValid(),
+                          "Reserved command flag bits are set.");
+
+            using List = FieldList<0, Fields...>;
+
+        public:
+
+            /**
+             * @brief AVP values in message order.
+             */
+            using Values = std::tuple<typename Fields::ValueType...>;
+
+            /**
+             * @brief Method for checking does message
+             * contain only fixed size AVPs.
+             * @return Is message length constant.
+             */
+            static constexpr bool isFixed()
+            {
+                return List::isFixed();
+            }
+
+            /**
+             * @brief Method for getting message length with
+             * empty octet strings. For fixed messages it's
+             * message length.
+             * @return Minimum length.
+             */
+            static constexpr uint32_t minimumLength()
+            {
+                return static_cast<uint32_t>(Packet::Header::Size) + List::minimumLength();
+            }
+
+            /**
+             * @brief Method for calculating message length.
+             * @param values AVP values.
+             * @return Message length.
+             */
+            static std::size_t calculateLength(const Values& values)
+            {
+                return isFixed() ?
+                       minimumLength() :
+                       static_cast<uint32_t>(Packet::Header::Size) + List::length(values);
+            }
+
+            /**
+             * @brief Method for encoding message to raw memory.
+             * calculateLength bytes are written. If length does
+             * not fit into 24 bits, std::invalid_argument
+             * exception will be thrown.
+             * @param values AVP values.
+             * @param hbh Hop-by-hop identifier.
+             * @param ete End-to-end identifier.
+             * @param data Pointer to destination.
+             * @return Pointer past written bytes.
+             */
+            static uint8_t* encode(const Values& values,
+                                   Packet::Header::HBHType hbh,
+                                   Packet::Header::ETEType ete,
+                                   uint8_t* data)
+            {
+                return write(values, calculateLength(values), hbh, ete, data);
+            }
+
+            /**
+             * @brief Method for encoding message.
+             * Message will be appended to byte array.
+             * @param values AVP values.
+             * @param hbh Hop-by-hop identifier.
+             * @param ete End-to-end identifier.
+             * @param byteArray Byte array.
+             */
+            static void encode(const Values& values,
+                               Packet::Header::HBHType hbh,
+                               Packet::Header::ETEType ete,
+                               ByteArray& byteArray)
+            {
+                auto length = calculateLength(values);
+                auto offset = byteArray.size();
+
+                byteArray.resize(offset + length);
+
+                write(values, length, hbh, ete, byteArray.data() + offset);
+            }
+
+            /**
+             * @brief Method for decoding message. Message has
+             * to contain exactly schema AVPs in schema order
+             * and its length field has to match size.
+             * Octet strings point into data.
+             * @param data Pointer to message.
+             * @param size Message size.
+             * @param values AVP values.
+             * @return Parsing result.
+             */
+            static ParseResult decode(const uint8_t* data, std::size_t size, Values& values)
+            {
+                if (size < static_cast<std::size_t>(Packet::Header::Size))
+                {
+                    return ParseResult(ParseResult::Code::HeaderTooSmall, 0, 0);
+                }
+
+                if (data[0] != 1)
+                {
+                    return ParseResult(ParseResult::Code::InvalidVersion, 0, 0);
+                }
+
+                if (!Packet::Header::Flags(data[4]).isValid())
+                {
+                    return ParseResult(ParseResult::Code::InvalidFlags, 4, 0);
+                }
+
+                if (Wire::readUInt32(data + 4) != commandWord() ||
+                    Wire::readUInt32(data + 8) != ApplicationId)
+                {
+                    return ParseResult(ParseResult::Code::SchemaMismatch, 4, 0);
+                }
+
+                uint32_t pointer = Packet::Header::Size;
+
+                ParseResult result;
+
+                // Whole fixed message is bounds checked at once
+                if (isFixed() && size == minimumLength())
+                {
+                    result = List::template decode<false>(data, pointer, static_cast<uint32_t>(size), values);
+                }
+                else
+                {
+                    result = List::template decode<true>(data, pointer, static_cast<uint32_t>(size), values);
+                }
+
+                if (result.isOk() && pointer != size)
+                {
+                    return ParseResult(ParseResult::Code::SchemaMismatch, pointer, 0);
+                }
+
+                // Header has to agree with message size
+                if (result.isOk() && Wire::readUInt24(data + 1) != size)
+                {
+                    return ParseResult(ParseResult::Code::SchemaMismatch, 1, 0);
+                }
+
+                return result;
+            }
+
+        private:
+
+            /**
+             * @brief Command flags and command code word.
+             */
+            static constexpr uint32_t commandWord()
+            {
+                return (static_cast<uint32_t>(CommandFlags) << 24) | CommandCode;
+            }
+
+            static uint8_t* write(const Values& values,
+                                  std::size_t length,
+                                  Packet::Header::HBHType hbh,
+                                  Packet::Header::ETEType ete,
+                                  uint8_t* data)
+            {
+                if (length > 0xFFFFFF)
+                {
+                    DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+                }
+
+                Wire::writeUInt32(data, (1u << 24) | static_cast<uint32_t>(length));
+                Wire::writeUInt32(data + 4, commandWord());
+                Wire::writeUInt32(data + 8, ApplicationId);
+                Wire::writeUInt32(data + 12, hbh);
+                Wire::writeUInt32(data + 16, ete);
+
+                return List::encode(values, data + Packet::Header::Size);
+            }
+        };
+    }
+}
@@ -0,0 +1,137 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#endif
+
+namespace Diameter
+{
+    class Packet;
+
+    /**
+     * @brief Scatter-gather output of packet serialization.
+     *
+     * Headers, small values and padding are written into
+     * scratch buffer. Values, that are not smaller than
+     * threshold, are referenced in place. Segments are
+     * valid until packet is modified or list is deployed
+     * into again.
+     *
+     * Usage:
+     * @code
+     * Diameter::SegmentList segments;
+     *
+     * packet.deploy(segments);
+     *
+     * std::vector<iovec> vectors;
+     * segments.toIOVec(vectors);
+     *
+     * writev(socket, vectors.data(), vectors.size());
+     * @endcode
+     */
+    class SegmentList
+    {
+    public:
+
+        /**
+         * @brief Contiguous part of serialized packet.
+         */
+        struct Segment
+        {
+            const uint8_t* data;
+            std::size_t size;
+        };
+
+        /**
+         * @brief Constructor.
+         * @param threshold Minimal size of value in bytes,
+         * that is referenced instead of copying.
+         */
+        explicit SegmentList(uint32_t threshold=512);
+
+        SegmentList(const SegmentList&) = delete;
+        SegmentList& operator=(const SegmentList&) = delete;
+
+        /**
+         * @brief Method for getting segments.
+         * @return Segments in wire order.
+         */
+        const std::vector<Segment>& segments() const;
+
+        /**
+         * @brief Method for getting total size of
+         * all segments.
+         * @return Size in bytes.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Method for getting number of bytes,
+         * copied into scratch buffer.
+         * @return Size in bytes.
+         */
+        std::size_t copied() const;
+
+        /**
+         * @brief Method for getting threshold.
+         * @return Minimal size of referenced value.
+         */
+        uint32_t threshold() const;
+
+        /**
+         * @brief Method for dropping segments.
+         * Scratch buffer memory is kept.
+         */
+        void clear();
+
+#if defined(__unix__) || defined(__APPLE__)
+        /**
+         * @brief Method for converting segments to
+         * iovec array for `writev`/`sendmsg`.
+         * @param vectors Container, that will be filled.
+         */
+        void toIOVec(std::vector<iovec>& vectors) const;
+#endif
+
+    private:
+        friend class Packet;
+
+        /**
+         * @brief Method for preparing scratch buffer.
+         * It's allocated before any segment is added, so
+         * segment pointers stay valid.
+         * @param size Required scratch size in bytes.
+         * @return Pointer to scratch.
+         */
+        uint8_t* prepare(std::size_t size);
+
+        /**
+         * @brief Method for closing scratch segment,
+         * that ends at cursor.
+         * @param cursor Pointer past last written scratch byte.
+         */
+        void flush(const uint8_t* cursor);
+
+        /**
+         * @brief Method for referencing external memory.
+         * @param cursor Pointer past last written scratch byte.
+         * @param data Pointer to referenced bytes.
+         * @param size Number of bytes.
+         */
+        void reference(const uint8_t* cursor, const uint8_t* data, std::size_t size);
+
+        uint32_t m_threshold;
+        std::vector<uint8_t> m_scratch;
+        std::vector<Segment> m_segments;
+        const uint8_t* m_segmentStart;
+        std::size_t m_size;
+    };
+}
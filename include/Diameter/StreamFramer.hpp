@@ -0,0 +1,126 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace Diameter
+{
+    /**
+     * @brief Class for splitting byte stream (eg. TCP)
+     * into Diameter messages, using message length from
+     * packet header.
+     *
+     * Messages, that lie entirely inside fed chunk, are
+     * handed out in place without copying. Message, that
+     * spans several chunks, is coalesced into internal
+     * buffer with single copy. Buffer is allocated once
+     * with fixed capacity, that limits message size.
+     *
+     * Usage:
+     * @code
+     * framer.feed(chunk, chunkSize);
+     *
+     * const uint8_t* message;
+     * uint32_t size;
+     *
+     * while (framer.next(message, size) == Diameter::StreamFramer::Status::Message)
+     * {
+     *     // Process message
+     * }
+     * @endcode
+     */
+    class StreamFramer
+    {
+    public:
+
+        /**
+         * @brief Framing status.
+         */
+        enum class Status
+        {
+              Message       //< Complete message was handed out.
+            , NeedMoreData  //< Chunk is consumed. Next chunk has to be fed.
+            , InvalidLength //< Message length is smaller than header. Stream can't be recovered.
+            , TooLarge      //< Message length exceeds capacity. Stream can't be recovered.
+        };
+
+        /**
+         * @brief Constructor.
+         * If capacity is smaller than packet header,
+         * std::invalid_argument exception will be thrown.
+         * @param capacity Maximum message size in bytes.
+         */
+        explicit StreamFramer(uint32_t capacity);
+
+        StreamFramer(const StreamFramer&) = delete;
+        StreamFramer& operator=(const StreamFramer&) = delete;
+
+        /**
+         * @brief Method for feeding next chunk of stream.
+         * Chunk is not copied, so it has to stay valid
+         * until `next` returns anything but Status::Message.
+         * If previous chunk is not consumed yet,
+         * std::logic_error exception will be thrown.
+         * @param data Pointer to chunk.
+         * @param size Chunk size.
+         */
+        void feed(const uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Method for getting next complete message.
+         * Message memory is valid until next call of `next`
+         * or `feed`.
+         * @param message Pointer to message.
+         * @param size Message size.
+         * @return Framing status.
+         */
+        Status next(const uint8_t*& message, uint32_t& size);
+
+        /**
+         * @brief Method for getting number of bytes of
+         * incomplete message, stored in internal buffer.
+         * @return Number of bytes.
+         */
+        uint32_t buffered() const;
+
+        /**
+         * @brief Method for getting maximum message size.
+         * @return Capacity in bytes.
+         */
+        uint32_t capacity() const;
+
+        /**
+         * @brief Method for dropping buffered data
+         * and current chunk. Used for recovering after
+         * framing error.
+         */
+        void reset();
+
+    private:
+
+        /**
+         * @brief Method for moving bytes from chunk
+         * to internal buffer.
+         * @param size Maximum number of bytes.
+         */
+        void take(uint32_t size);
+
+        /**
+         * @brief Method for checking message length.
+         * @param length Message length.
+         * @return Status::Message if it's valid.
+         */
+        Status checkLength(uint32_t length) const;
+
+        std::vector<uint8_t> m_buffer;
+        uint32_t m_buffered;
+
+        const uint8_t* m_chunk;
+        std::size_t m_chunkSize;
+    };
+}
@@ -0,0 +1,101 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace Diameter
+{
+    /**
+     * @brief Helpers for reading and writing network byte
+     * order (big endian) values from and to raw memory.
+     * They do not perform any bounds checking.
+     */
+    namespace Wire
+    {
+        /**
+         * @brief Function for reading 24 bit unsigned integer.
+         * @param data Pointer to first byte.
+         * @return Value.
+         */
+        inline uint32_t readUInt24(const uint8_t* data)
+        {
+            return (static_cast<uint32_t>(data[0]) << 16) |
+                   (static_cast<uint32_t>(data[1]) << 8)  |
+                    static_cast<uint32_t>(data[2]);
+        }
+
+        /**
+         * @brief Function for reading 32 bit unsigned integer.
+         * @param data Pointer to first byte.
+         * @return Value.
+         */
+        inline uint32_t readUInt32(const uint8_t* data)
+        {
+            return (static_cast<uint32_t>(data[0]) << 24) |
+                   (static_cast<uint32_t>(data[1]) << 16) |
+                   (static_cast<uint32_t>(data[2]) << 8)  |
+                    static_cast<uint32_t>(data[3]);
+        }
+
+        /**
+         * @brief Function for reading 64 bit unsigned integer.
+         * @param data Pointer to first byte.
+         * @return Value.
+         */
+        inline uint64_t readUInt64(const uint8_t* data)
+        {
+            return (static_cast<uint64_t>(readUInt32(data)) << 32) |
+                    static_cast<uint64_t>(readUInt32(data + 4));
+        }
+
+        /**
+         * @brief Function for writing lower 24 bits of value.
+         * @param data Pointer to first byte.
+         * @param value Value.
+         */
+        inline void writeUInt24(uint8_t* data, uint32_t value)
+        {
+            data[0] = static_cast<uint8_t>(value >> 16);
+            data[1] = static_cast<uint8_t>(value >> 8);
+            data[2] = static_cast<uint8_t>(value);
+        }
+
+        /**
+         * @brief Function for writing 32 bit unsigned integer.
+         * @param data Pointer to first byte.
+         * @param value Value.
+         */
+        inline void writeUInt32(uint8_t* data, uint32_t value)
+        {
+            data[0] = static_cast<uint8_t>(value >> 24);
+            data[1] = static_cast<uint8_t>(value >> 16);
+            data[2] = static_cast<uint8_t>(value >> 8);
+            data[3] = static_cast<uint8_t>(value);
+        }
+
+        /**
+         * @brief Function for writing 64 bit unsigned integer.
+         * @param data Pointer to first byte.
+         * @param value Value.
+         */
+        inline void writeUInt64(uint8_t* data, uint64_t value)
+        {
+            writeUInt32(data, static_cast<uint32_t>(value >> 32));
+            writeUInt32(data + 4, static_cast<uint32_t>(value));
+        }
+
+        /**
+         * @brief Function for calculating length with
+         * /4 padding applied.
+         * @param length Unpadded length.
+         * @return Padded length.
+         */
+        constexpr uint32_t padded(uint32_t length)
+        {
+            return (length + 3) & 0xFFFFFFFC;
+        }
+    }
+}
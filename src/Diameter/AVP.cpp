@@ -1,50 +1,98 @@
 #include <Diameter/AVP.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
+#include <cstring>
 
 Diameter::AVP::AVP() :
     m_header(),
-    m_data()
+    m_data(),
+    m_wire()
+{
+
+}
+
+Diameter::AVP::AVP(Diameter::Arena& arena) :
+    m_header(),
+    m_data(arena),
+    m_wire()
 {
 
 }
 
 Diameter::AVP::AVP(const ByteArray& array) :
     m_header(),
-    m_data()
+    m_data(),
+    m_wire()
 {
-    auto guessedSize = Header::MaxSize;
+    auto result = tryParse(array.data(), array.size(), *this);
 
-    if (array.length() < guessedSize)
+    if (!result.isOk())
     {
-        guessedSize = Header::MinSize;
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+}
 
-        if (array.length() < guessedSize)
-        {
-            throw std::invalid_argument("Can't parse AVP: Data is too small.");
-        }
+Diameter::ParseResult Diameter::AVP::tryParse(const uint8_t* data, std::size_t size, Diameter::AVP& avp)
+{
+    if (size < Header::MinSize)
+    {
+        return ParseResult(
+            ParseResult::Code::AVPHeaderTooSmall,
+            0,
+            size < sizeof(Header::AVPCodeType) ? 0 : Wire::readUInt32(data)
+        );
+    }
+
+    Header header;
+
+    header.avpCode() = Wire::readUInt32(data);
+    header.flags() = Header::Flags(data[4]);
+    header.length() = Wire::readUInt24(data + 5);
+
+    auto headerSize = header.calculateSize();
+
+    if (size < headerSize)
+    {
+        return ParseResult(ParseResult::Code::AVPHeaderTooSmall, 0, header.avpCode());
     }
 
-    m_header = Header(array.cut(0, guessedSize));
+    if (header.length() < headerSize)
+    {
+        return ParseResult(ParseResult::Code::AVPLengthTooSmall, 0, header.avpCode());
+    }
 
-    if (!m_header.flags().isSet(Header::Flags::Bits::VendorSpecific))
+    if (header.length() > size)
     {
-        guessedSize = Header::MinSize;
+        return ParseResult(ParseResult::Code::AVPLengthTooLarge, 0, header.avpCode());
+    }
 
-        m_header = Header(array.cut(0, guessedSize));
+    if (headerSize == Header::MaxSize)
+    {
+        header.setVendorID(Wire::readUInt32(data + 8));
     }
 
-    m_data = Data(array.cut(guessedSize, m_header.length()));
+    auto valueSize = header.length() - headerSize;
+
+    avp.m_header = std::move(header);
+    // Value buffer of AVP is reused
+    avp.m_data.setOctetString(data + headerSize, valueSize);
+    avp.forget();
+
+    return ParseResult();
 }
 
 Diameter::AVP::AVP(Diameter::AVP&& moved) noexcept :
     m_header(std::move(moved.m_header)),
-    m_data(std::move(moved.m_data))
+    m_data(std::move(moved.m_data)),
+    m_wire(std::move(moved.m_wire))
 {
 
 }
 
 Diameter::AVP::AVP(const Diameter::AVP& copied) :
     m_header(copied.m_header),
-    m_data(copied.m_data)
+    m_data(copied.m_data),
+    m_wire(copied.m_wire)
 {
 
 }
@@ -53,12 +101,15 @@ Diameter::AVP& Diameter::AVP::operator=(const Diameter::AVP& copied)
 {
     m_header = copied.m_header;
     m_data = copied.m_data;
+    m_wire = copied.m_wire;
 
     return (*this);
 }
 
 Diameter::AVP& Diameter::AVP::setHeader(const Diameter::AVP::Header& value)
 {
+    forget();
+
     m_header = value;
     return (*this);
 }
@@ -70,23 +121,40 @@ Diameter::AVP::Header Diameter::AVP::header() const
 
 Diameter::AVP::Header& Diameter::AVP::header()
 {
+    // Header may be modified through reference
+    forget();
+
     return m_header;
 }
 
 Diameter::AVP& Diameter::AVP::setData(const Diameter::AVP::Data& value)
 {
+    forget();
+
     m_data = value;
 
     return (*this);
 }
 
-Diameter::AVP::Data Diameter::AVP::data() const
+Diameter::AVP& Diameter::AVP::setData(Diameter::AVP::Data&& value)
+{
+    forget();
+
+    m_data = std::move(value);
+
+    return (*this);
+}
+
+const Diameter::AVP::Data& Diameter::AVP::data() const
 {
     return m_data;
 }
 
 Diameter::AVP::Data& Diameter::AVP::data()
 {
+    // Data may be modified through reference
+    forget();
+
     return m_data;
 }
 
@@ -106,6 +174,7 @@ Diameter::AVP& Diameter::AVP::operator=(Diameter::AVP&& moved) noexcept
 {
     m_header = std::move(moved.m_header);
     m_data   = std::move(moved.m_data);
+    m_wire   = std::move(moved.m_wire);
 
     return *this;
 }
@@ -125,6 +194,11 @@ Diameter::AVP::Header::LengthType Diameter::AVP::calculateLength(bool includePad
 
 Diameter::AVP& Diameter::AVP::updateLength()
 {
+    if (m_header.length() != calculateLength(false))
+    {
+        forget();
+    }
+
     m_header.setAVPLength(calculateLength(false));
 
     return *this;
@@ -132,22 +206,65 @@ Diameter::AVP& Diameter::AVP::updateLength()
 
 void Diameter::AVP::deploy(ByteArray& byteArray) const
 {
-    byteArray.append(m_header.deploy());
-    byteArray.append(m_data.deploy());
+    auto offset = byteArray.size();
 
-    if (m_data.size() % 4)
+    byteArray.resize(offset + calculateLength(true));
+
+    deploy(byteArray.data() + offset);
+}
+
+uint8_t* Diameter::AVP::deploy(uint8_t* data) const
+{
+    if (!m_wire.empty())
     {
-        auto requiredPadding = 4 - (m_data.size() % 4);
+        std::memcpy(data, m_wire.data(), m_wire.size());
 
-        byteArray.appendMultiple<uint8_t>(0, requiredPadding);
+        return data + m_wire.size();
     }
+
+    auto size = m_data.size();
+
+    data = m_header.deploy(data);
+    data = m_data.deploy(data);
+
+    auto padding = Wire::padded(size) - size;
+
+    for (uint32_t i = 0; i < padding; ++i)
+    {
+        *data++ = 0;
+    }
+
+    return data;
 }
 
 ByteArray Diameter::AVP::deploy() const
 {
-    ByteArray byteArray(calculateLength(true));
+    ByteArray byteArray;
 
     deploy(byteArray);
 
     return byteArray;
 }
+
+Diameter::AVP& Diameter::AVP::memoize()
+{
+    forget();
+
+    ByteArray wire;
+
+    deploy(wire);
+
+    m_wire = std::move(wire);
+
+    return *this;
+}
+
+bool Diameter::AVP::isMemoized() const
+{
+    return !m_wire.empty();
+}
+
+void Diameter::AVP::forget()
+{
+    m_wire.clear();
+}
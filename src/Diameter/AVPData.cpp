@@ -1,130 +1,246 @@
 #include <Diameter/AVP.hpp>
+#include <Diameter/AVPView.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
+#include <cstring>
+
+const uint32_t Diameter::AVP::Data::InlineSize;
 
 Diameter::AVP::Data::Data() :
-    m_value()
+    m_inline(),
+    m_valueSize(0),
+    m_value(),
+    m_children(),
+    m_childrenSize(0),
+    m_arena(nullptr),
+    m_arenaValue(nullptr),
+    m_arenaCapacity(0)
 {
 
 }
 
+Diameter::AVP::Data::Data(Diameter::Arena& arena) :
+    Data()
+{
+    m_arena = &arena;
+}
+
 Diameter::AVP::Data::Data(const ByteArray& array) :
-    m_value(array)
+    Data()
 {
+    assign(array.data(), array.size());
+}
 
+Diameter::AVP::Data::Data(ByteArray&& array) :
+    Data()
+{
+    if (array.size() <= InlineSize)
+    {
+        assign(array.data(), array.size());
+    }
+    else
+    {
+        m_value = std::move(array);
+        m_valueSize = static_cast<uint32_t>(m_value.size());
+    }
+}
+
+Diameter::AVP::Data::Data(const uint8_t* data, std::size_t size) :
+    Data()
+{
+    assign(data, size);
 }
 
 Diameter::AVP::Data::Data(Diameter::AVP::Data&& moved) noexcept :
-    m_value(std::move(moved.m_value))
+    m_inline(),
+    m_valueSize(moved.m_valueSize),
+    m_value(std::move(moved.m_value)),
+    m_children(std::move(moved.m_children)),
+    m_childrenSize(moved.m_childrenSize),
+    m_arena(moved.m_arena),
+    m_arenaValue(moved.m_arenaValue),
+    m_arenaCapacity(moved.m_arenaCapacity)
 {
+    if (m_valueSize <= InlineSize)
+    {
+        std::memcpy(m_inline, moved.m_inline, m_valueSize);
+    }
 
+    moved.m_valueSize = 0;
+    moved.m_childrenSize = 0;
+    moved.m_arenaValue = nullptr;
+    moved.m_arenaCapacity = 0;
 }
 
 Diameter::AVP::Data::Data(const Diameter::AVP::Data& copied) :
-    m_value(copied.m_value)
+    Data()
 {
-
+    // Copy does not use arena
+    assign(copied.valueData(), copied.m_valueSize);
+    shareChildren(copied);
 }
 
 Diameter::AVP::Data& Diameter::AVP::Data::operator=(const Diameter::AVP::Data& rhs)
 {
-    m_value = rhs.m_value;
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    // Arena of data is kept
+    assign(rhs.valueData(), rhs.m_valueSize);
+    shareChildren(rhs);
 
     return *this;
 }
 
 Diameter::AVP::Data& Diameter::AVP::Data::operator=(Diameter::AVP::Data&& rhs) noexcept
 {
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    if (rhs.m_valueSize <= InlineSize)
+    {
+        std::memcpy(m_inline, rhs.m_inline, rhs.m_valueSize);
+    }
+
+    // Arena is taken with its memory
+    m_valueSize = rhs.m_valueSize;
     m_value = std::move(rhs.m_value);
+    m_children = std::move(rhs.m_children);
+    m_childrenSize = rhs.m_childrenSize;
+    m_arena = rhs.m_arena;
+    m_arenaValue = rhs.m_arenaValue;
+    m_arenaCapacity = rhs.m_arenaCapacity;
+    rhs.m_valueSize = 0;
+    rhs.m_childrenSize = 0;
+    rhs.m_arenaValue = nullptr;
+    rhs.m_arenaCapacity = 0;
 
     return *this;
 }
 
 ByteArray Diameter::AVP::Data::toOctetString() const
 {
-    return m_value;
+    if (!m_children && m_valueSize > InlineSize && m_arena == nullptr)
+    {
+        return m_value;
+    }
+
+    // Added AVPs are serialized right into result
+    ByteArray result;
+
+    deploy(result);
+
+    return result;
 }
 
 int32_t Diameter::AVP::Data::toInteger32() const
 {
-    if (m_value.size() != 4)
-    {
-        throw std::invalid_argument("Data size is not equal 4.");
-    }
-
-    return m_value.read<int32_t>(0);
+    return static_cast<int32_t>(toUnsigned32());
 }
 
 int64_t Diameter::AVP::Data::toInteger64() const
 {
-    if (m_value.size() != 8)
-    {
-        throw std::invalid_argument("Data size is not equal 8.");
-    }
-
-    return m_value.read<int64_t>(0);
+    return static_cast<int64_t>(toUnsigned64());
 }
 
 uint32_t Diameter::AVP::Data::toUnsigned32() const
 {
-    if (m_value.size() != 4)
+    if (size() != 4)
     {
-        throw std::invalid_argument("Data size is not equal 4.");
+        DIAMETER_THROW(std::invalid_argument("Data size is not equal 4."));
     }
 
-    return m_value.read<uint32_t>(0);
+    uint8_t buffer[4];
+
+    return Wire::readUInt32(read(buffer));
 }
 
 uint64_t Diameter::AVP::Data::toUnsigned64() const
 {
-    if (m_value.size() != 8)
+    if (size() != 8)
     {
-        throw std::invalid_argument("Data size is not equal 8.");
+        DIAMETER_THROW(std::invalid_argument("Data size is not equal 8."));
     }
 
-    return m_value.read<uint64_t>(0);
+    uint8_t buffer[8];
+
+    return Wire::readUInt64(read(buffer));
 }
 
 Diameter::AVP::Data& Diameter::AVP::Data::setOctetString(const ByteArray& value)
 {
-    m_value = value;
+    assign(value.data(), value.size());
 
     return (*this);
 }
 
-Diameter::AVP::Data& Diameter::AVP::Data::setInteger32(int32_t value)
+Diameter::AVP::Data& Diameter::AVP::Data::setOctetString(const uint8_t* data, std::size_t size)
 {
-    m_value.clear();
-    m_value.append<int32_t>(value);
+    assign(data, size);
 
     return (*this);
 }
 
-Diameter::AVP::Data& Diameter::AVP::Data::setInteger64(int64_t value)
+Diameter::AVP::Data& Diameter::AVP::Data::setInteger32(int32_t value)
 {
-    m_value.clear();
-    m_value.append<int64_t>(value);
+    return setUnsigned32(static_cast<uint32_t>(value));
+}
 
-    return (*this);
+Diameter::AVP::Data& Diameter::AVP::Data::setInteger64(int64_t value)
+{
+    return setUnsigned64(static_cast<uint64_t>(value));
 }
 
 Diameter::AVP::Data& Diameter::AVP::Data::setUnsigned32(uint32_t value)
 {
-    m_value.clear();
-    m_value.append<uint32_t>(value);
+    uint8_t bytes[sizeof(value)];
+
+    Wire::writeUInt32(bytes, value);
+
+    assign(bytes, sizeof(bytes));
 
     return (*this);
 }
 
 Diameter::AVP::Data& Diameter::AVP::Data::setUnsigned64(uint64_t value)
 {
-    m_value.clear();
-    m_value.append<uint64_t>(value);
+    uint8_t bytes[sizeof(value)];
+
+    Wire::writeUInt64(bytes, value);
+
+    assign(bytes, sizeof(bytes));
 
     return (*this);
 }
 
 Diameter::AVP::Data& Diameter::AVP::Data::addAVP(const Diameter::AVP &avp)
 {
-    m_value.append(avp.deploy());
+    auto& children = ownChildren();
+
+    if (m_arena != nullptr)
+    {
+        // Assigned value is copied into arena
+        children.emplace_back(*m_arena);
+        children.back() = avp;
+    }
+    else
+    {
+        children.push_back(avp);
+    }
+
+    m_childrenSize += avp.calculateLength(true);
+
+    return (*this);
+}
+
+Diameter::AVP::Data& Diameter::AVP::Data::addAVP(Diameter::AVP&& avp)
+{
+    m_childrenSize += avp.calculateLength(true);
+    ownChildren().push_back(std::move(avp));
 
     return (*this);
 }
@@ -133,60 +249,297 @@ Diameter::AVP::Data::AVPContainer Diameter::AVP::Data::toAVPs() const
 {
     AVPContainer container;
 
-    if (m_value.empty())
+    auto result = tryToAVPs(container);
+
+    if (!result.isOk())
     {
-        return container;
+        DIAMETER_THROW(std::invalid_argument(result.message()));
     }
 
-    // Trying to calculate things
+    return container;
+}
+
+Diameter::ParseResult Diameter::AVP::Data::tryToAVPs(Diameter::AVP::Data::AVPContainer& container) const
+{
+    uint32_t numberOfAVPs = m_children ? static_cast<uint32_t>(m_children->size()) : 0;
     uint32_t pointer = 0;
 
-    while (pointer < m_value.size())
+    auto value = valueData();
+    auto size = valueSize();
+
+    AVPView view;
+
+    // Validating first
+    while (pointer < size)
     {
-        // Trying to read AVP length
-        if (pointer + Header::MinSize >= m_value.size())
+        auto result = AVPView::tryParse(value + pointer, size - pointer, view);
+
+        if (!result.isOk())
         {
-            throw std::invalid_argument("Data has no any AVPs");
+            return result.shifted(pointer);
         }
 
-        AVP::Header header(m_value.cut(pointer, pointer + Header::MinSize));
+        pointer += view.paddedLength();
 
-        auto realLength = header.length();
+        ++numberOfAVPs;
+    }
 
-        // Performing /4 padding
-        realLength = (realLength + 3) & 0xFFFFFFFC;
+    container.reserve(container.size() + numberOfAVPs);
 
-        // Can this be size?
-        if (pointer + realLength > m_value.size())
-        {
-            throw std::invalid_argument("Data has no any AVPs");
-        }
+    for (pointer = 0; pointer < size; pointer += view.paddedLength())
+    {
+        view = AVPView(value + pointer, size - pointer);
 
-        container.emplace_back(m_value.mid(pointer, realLength));
+        container.emplace_back(view.toAVP());
+    }
 
-        pointer += realLength;
+    if (m_children)
+    {
+        container.insert(container.end(), m_children->begin(), m_children->end());
     }
 
-    return container;
+    return ParseResult();
 }
 
 uint32_t Diameter::AVP::Data::size() const
 {
-    return m_value.size();
+    return valueSize() + m_childrenSize;
+}
+
+const uint8_t* Diameter::AVP::Data::data() const
+{
+    if (m_children)
+    {
+        return nullptr;
+    }
+
+    return valueData();
 }
 
 void Diameter::AVP::Data::deploy(ByteArray& byteArray) const
 {
-    byteArray.append(m_value);
+    auto offset = byteArray.size();
+
+    byteArray.resize(offset + size());
+
+    deploy(byteArray.data() + offset);
+}
+
+uint8_t* Diameter::AVP::Data::deploy(uint8_t* data) const
+{
+    auto size = valueSize();
+
+    if (size != 0)
+    {
+        std::memcpy(data, valueData(), size);
+
+        data += size;
+    }
+
+    if (!m_children)
+    {
+        return data;
+    }
+
+    // Nested AVPs are written right into destination
+    for (auto& child : *m_children)
+    {
+        data = child.deploy(data);
+    }
+
+    return data;
 }
 
 ByteArray Diameter::AVP::Data::deploy() const
 {
-    return m_value;
+    ByteArray result;
+
+    deploy(result);
+
+    return result;
 }
 
 bool Diameter::AVP::Data::isValid() const
 {
-    // Проверяем выравнивание
+    if (!m_children)
+    {
+        return true;
+    }
+
+    for (auto& child : *m_children)
+    {
+        if (!child.isValid())
+        {
+            return false;
+        }
+    }
+
     return true;
-}
\ No newline at end of file
+}
+
+void Diameter::AVP::Data::assign(const uint8_t* data, std::size_t size)
+{
+    if (size <= InlineSize)
+    {
+        if (size != 0)
+        {
+            std::memmove(m_inline, data, size);
+        }
+
+        m_value.clear();
+    }
+    else if (m_arena != nullptr)
+    {
+        std::memmove(allocateValue(size), data, size);
+    }
+    else
+    {
+        m_value.clear();
+        m_value.insert(m_value.end(), data, data + size);
+    }
+
+    m_valueSize = static_cast<uint32_t>(size);
+
+    m_children.reset();
+    m_childrenSize = 0;
+}
+
+const uint8_t* Diameter::AVP::Data::valueData() const
+{
+    if (m_valueSize <= InlineSize)
+    {
+        return m_inline;
+    }
+
+    return m_arena != nullptr ? m_arenaValue : m_value.data();
+}
+
+uint32_t Diameter::AVP::Data::valueSize() const
+{
+    return m_valueSize;
+}
+
+const uint8_t* Diameter::AVP::Data::read(uint8_t* buffer) const
+{
+    if (!m_children)
+    {
+        return valueData();
+    }
+
+    deploy(buffer);
+
+    return buffer;
+}
+
+Diameter::AVP::Data& Diameter::AVP::Data::flatten()
+{
+    if (!m_children)
+    {
+        return (*this);
+    }
+
+    uint8_t* data;
+
+    auto size = m_valueSize + m_childrenSize;
+
+    if (size <= InlineSize)
+    {
+        data = m_inline + m_valueSize;
+    }
+    else if (m_arena != nullptr)
+    {
+        if (m_arenaCapacity < size)
+        {
+            // Previous buffer is left to arena
+            auto buffer = static_cast<uint8_t*>(m_arena->allocate(size, 1));
+
+            std::memcpy(buffer, valueData(), m_valueSize);
+
+            m_arenaValue = buffer;
+            m_arenaCapacity = size;
+        }
+        else if (m_valueSize <= InlineSize)
+        {
+            std::memcpy(m_arenaValue, m_inline, m_valueSize);
+        }
+
+        data = m_arenaValue + m_valueSize;
+    }
+    else
+    {
+        // Inline value is moved to heap first
+        if (m_valueSize <= InlineSize)
+        {
+            m_value.clear();
+            m_value.insert(m_value.end(), m_inline, m_inline + m_valueSize);
+        }
+
+        m_value.resize(m_valueSize + m_childrenSize);
+
+        data = m_value.data() + m_valueSize;
+    }
+
+    m_valueSize += m_childrenSize;
+
+    for (auto& child : *m_children)
+    {
+        data = child.deploy(data);
+    }
+
+    // Other copies of data keep their AVPs
+    m_children.reset();
+    m_childrenSize = 0;
+
+    return (*this);
+}
+
+uint8_t* Diameter::AVP::Data::allocateValue(std::size_t size)
+{
+    if (m_arenaCapacity < size)
+    {
+        m_arenaValue = static_cast<uint8_t*>(m_arena->allocate(size, 1));
+        m_arenaCapacity = static_cast<uint32_t>(size);
+    }
+
+    return m_arenaValue;
+}
+
+Diameter::AVP::Data::Children& Diameter::AVP::Data::ownChildren()
+{
+    ArenaAllocator<AVP> allocator(m_arena);
+
+    if (!m_children)
+    {
+        m_children = std::allocate_shared<Children>(allocator, allocator);
+    }
+    else if (m_children.use_count() > 1)
+    {
+        m_children = std::allocate_shared<Children>(allocator, m_children->begin(), m_children->end(), allocator);
+    }
+
+    return *m_children;
+}
+
+void Diameter::AVP::Data::shareChildren(const Diameter::AVP::Data& other)
+{
+    m_childrenSize = other.m_childrenSize;
+
+    if (!other.m_children ||
+        other.m_arena == nullptr ||
+        other.m_arena == m_arena)
+    {
+        m_children = other.m_children;
+
+        return;
+    }
+
+    // Arena of other data may be reset before this data is destroyed
+    ArenaAllocator<AVP> allocator(m_arena);
+
+    m_children = std::allocate_shared<Children>(
+        allocator,
+        other.m_children->begin(),
+        other.m_children->end(),
+        allocator
+    );
+}
@@ -1,4 +1,6 @@
 #include <Diameter/AVP.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
 
 Diameter::AVP::Header::Header() :
     m_avpCode(0),
@@ -17,7 +19,7 @@ Diameter::AVP::Header::Header(const ByteArray& byteArray) :
 {
     if (byteArray.size() < MinSize)
     {
-        throw std::invalid_argument("Can't parse AVP Header: Data is too small.");
+        DIAMETER_THROW(std::invalid_argument("Can't parse AVP Header: Data is too small."));
     }
 
     // Trying to parse some data
@@ -121,7 +123,7 @@ Diameter::AVP::Header& Diameter::AVP::Header::setVendorID(Diameter::AVP::Header:
 {
     if (!m_flags.isSet(Flags::Bits::VendorSpecific))
     {
-        throw std::invalid_argument("Vendor specific bit is not set.");
+        DIAMETER_THROW(std::invalid_argument("Vendor specific bit is not set."));
     }
 
     m_vendorId = id;
@@ -133,7 +135,7 @@ Diameter::AVP::Header::VendorIdType Diameter::AVP::Header::vendorId() const
 {
     if (!m_flags.isSet(Flags::Bits::VendorSpecific))
     {
-        throw std::invalid_argument("Vendor specific bit is not set.");
+        DIAMETER_THROW(std::invalid_argument("Vendor specific bit is not set."));
     }
 
     return m_vendorId;
@@ -177,12 +179,25 @@ ByteArray Diameter::AVP::Header::deploy() const
 
 void Diameter::AVP::Header::deploy(ByteArray& byteArray) const
 {
-    byteArray.append(m_avpCode);
-    byteArray.append(m_flags.deploy());
-    byteArray.appendPart(m_length, 3);
+    auto offset = byteArray.size();
+
+    byteArray.resize(offset + calculateSize());
+
+    deploy(byteArray.data() + offset);
+}
+
+uint8_t* Diameter::AVP::Header::deploy(uint8_t* data) const
+{
+    Wire::writeUInt32(data, m_avpCode);
+    data[4] = m_flags.deploy();
+    Wire::writeUInt24(data + 5, m_length);
 
     if (m_flags.isSet(Flags::Bits::VendorSpecific))
     {
-        byteArray.append(m_vendorId);
+        Wire::writeUInt32(data + 8, m_vendorId);
+
+        return data + MaxSize;
     }
+
+    return data + MinSize;
 }
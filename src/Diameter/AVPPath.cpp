@@ -0,0 +1,31 @@
+#include <Diameter/AVPPath.hpp>
+
+Diameter::AVPPath::AVPPath() :
+    m_steps()
+{
+
+}
+
+Diameter::AVPPath& Diameter::AVPPath::child(Diameter::AVP::Header::AVPCodeType code,
+                                            Diameter::AVP::Header::VendorIdType vendorId,
+                                            uint32_t occurrence)
+{
+    m_steps.push_back(Step{code, vendorId, occurrence});
+
+    return *this;
+}
+
+const std::vector<Diameter::AVPPath::Step>& Diameter::AVPPath::steps() const
+{
+    return m_steps;
+}
+
+uint32_t Diameter::AVPPath::depth() const
+{
+    return static_cast<uint32_t>(m_steps.size());
+}
+
+bool Diameter::AVPPath::empty() const
+{
+    return m_steps.empty();
+}
@@ -0,0 +1,308 @@
+#include <Diameter/AVPView.hpp>
+#include <Diameter/Wire.hpp>
+#include <Diameter/Exceptions.hpp>
+
+Diameter::AVPView::Iterator::Iterator() :
+    m_begin(nullptr),
+    m_position(nullptr),
+    m_end(nullptr),
+    m_result()
+{
+
+}
+
+Diameter::AVPView::Iterator::Iterator(const uint8_t* position, const uint8_t* end) :
+    m_begin(position),
+    m_position(position),
+    m_end(end),
+    m_result()
+{
+    check();
+}
+
+Diameter::AVPView Diameter::AVPView::Iterator::operator*() const
+{
+    // AVP is already checked
+    AVPView view;
+
+    view.m_data = m_position;
+
+    return view;
+}
+
+Diameter::AVPView::Iterator& Diameter::AVPView::Iterator::operator++()
+{
+    m_position += Wire::padded(Wire::readUInt24(m_position + 5));
+
+    check();
+
+    return *this;
+}
+
+Diameter::ParseResult Diameter::AVPView::Iterator::result() const
+{
+    return m_result;
+}
+
+void Diameter::AVPView::Iterator::check()
+{
+    if (m_position == m_end)
+    {
+        return;
+    }
+
+    AVPView view;
+
+    auto result = tryParse(m_position, static_cast<std::size_t>(m_end - m_position), view);
+
+    if (!result.isOk())
+    {
+        // Data from peer may be malformed, so it's
+        // reported instead of thrown
+        m_result = result.shifted(static_cast<uint32_t>(m_position - m_begin));
+        m_position = m_end;
+    }
+}
+
+bool Diameter::AVPView::Iterator::operator==(const Diameter::AVPView::Iterator& rhs) const
+{
+    return m_position == rhs.m_position;
+}
+
+bool Diameter::AVPView::Iterator::operator!=(const Diameter::AVPView::Iterator& rhs) const
+{
+    return m_position != rhs.m_position;
+}
+
+Diameter::AVPView::AVPView() :
+    m_data(nullptr)
+{
+
+}
+
+Diameter::AVPView::AVPView(const uint8_t* data, std::size_t size) :
+    m_data(nullptr)
+{
+    auto result = tryParse(data, size, *this);
+
+    if (!result.isOk())
+    {
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+}
+
+Diameter::ParseResult Diameter::AVPView::tryParse(const uint8_t* data, std::size_t size, Diameter::AVPView& view)
+{
+    if (size < AVP::Header::MinSize)
+    {
+        return ParseResult(
+            ParseResult::Code::AVPHeaderTooSmall,
+            0,
+            size < sizeof(AVP::Header::AVPCodeType) ? 0 : Wire::readUInt32(data)
+        );
+    }
+
+    auto code = Wire::readUInt32(data);
+    auto length = Wire::readUInt24(data + 5);
+
+    auto headerSize = (data[4] & static_cast<uint8_t>(AVP::Header::Flags::Bits::VendorSpecific)) ?
+                      AVP::Header::MaxSize :
+                      AVP::Header::MinSize;
+
+    if (size < headerSize)
+    {
+        return ParseResult(ParseResult::Code::AVPHeaderTooSmall, 0, code);
+    }
+
+    if (length < headerSize)
+    {
+        return ParseResult(ParseResult::Code::AVPLengthTooSmall, 0, code);
+    }
+
+    if (Wire::padded(length) > size)
+    {
+        return ParseResult(ParseResult::Code::AVPLengthTooLarge, 0, code);
+    }
+
+    view.m_data = data;
+
+    return ParseResult();
+}
+
+Diameter::AVP::Header::AVPCodeType Diameter::AVPView::avpCode() const
+{
+    return Wire::readUInt32(m_data);
+}
+
+Diameter::AVP::Header::Flags Diameter::AVPView::flags() const
+{
+    return AVP::Header::Flags(m_data[4]);
+}
+
+Diameter::AVP::Header::LengthType Diameter::AVPView::length() const
+{
+    return Wire::readUInt24(m_data + 5);
+}
+
+Diameter::AVP::Header::LengthType Diameter::AVPView::paddedLength() const
+{
+    return Wire::padded(length());
+}
+
+Diameter::AVP::Header::VendorIdType Diameter::AVPView::vendorId() const
+{
+    if ((m_data[4] & static_cast<uint8_t>(AVP::Header::Flags::Bits::VendorSpecific)) == 0)
+    {
+        DIAMETER_THROW(std::invalid_argument("Vendor specific bit is not set."));
+    }
+
+    return Wire::readUInt32(m_data + 8);
+}
+
+Diameter::AVP::Header::LengthType Diameter::AVPView::headerSize() const
+{
+    if ((m_data[4] & static_cast<uint8_t>(AVP::Header::Flags::Bits::VendorSpecific)) != 0)
+    {
+        return AVP::Header::MaxSize;
+    }
+    else
+    {
+        return AVP::Header::MinSize;
+    }
+}
+
+Diameter::AVP::Header Diameter::AVPView::header() const
+{
+    AVP::Header header;
+
+    header.avpCode() = avpCode();
+    header.flags() = flags();
+    header.length() = length();
+
+    if (headerSize() == AVP::Header::MaxSize)
+    {
+        header.setVendorID(Wire::readUInt32(m_data + 8));
+    }
+
+    return header;
+}
+
+const uint8_t* Diameter::AVPView::raw() const
+{
+    return m_data;
+}
+
+const uint8_t* Diameter::AVPView::data() const
+{
+    return m_data + headerSize();
+}
+
+uint32_t Diameter::AVPView::dataSize() const
+{
+    return length() - headerSize();
+}
+
+ByteArray Diameter::AVPView::toOctetString() const
+{
+    auto size = dataSize();
+
+    ByteArray byteArray(size);
+
+    byteArray.insert(byteArray.end(), data(), data() + size);
+
+    return byteArray;
+}
+
+int32_t Diameter::AVPView::toInteger32() const
+{
+    return static_cast<int32_t>(toUnsigned32());
+}
+
+int64_t Diameter::AVPView::toInteger64() const
+{
+    return static_cast<int64_t>(toUnsigned64());
+}
+
+uint32_t Diameter::AVPView::toUnsigned32() const
+{
+    if (dataSize() != 4)
+    {
+        DIAMETER_THROW(std::invalid_argument("Data size is not equal 4."));
+    }
+
+    return Wire::readUInt32(data());
+}
+
+uint64_t Diameter::AVPView::toUnsigned64() const
+{
+    if (dataSize() != 8)
+    {
+        DIAMETER_THROW(std::invalid_argument("Data size is not equal 8."));
+    }
+
+    return Wire::readUInt64(data());
+}
+
+Diameter::AVPView::Iterator Diameter::AVPView::begin() const
+{
+    return Iterator(data(), data() + dataSize());
+}
+
+Diameter::AVPView::Iterator Diameter::AVPView::end() const
+{
+    return Iterator(data() + dataSize(), data() + dataSize());
+}
+
+Diameter::ParseResult Diameter::AVPView::checkChildren() const
+{
+    auto iterator = begin();
+
+    while (iterator != end())
+    {
+        ++iterator;
+    }
+
+    return iterator.result();
+}
+
+bool Diameter::AVPView::isValid() const
+{
+    return flags().isValid();
+}
+
+bool Diameter::AVPView::empty() const
+{
+    return m_data == nullptr;
+}
+
+Diameter::AVP Diameter::AVPView::toAVP() const
+{
+    AVP avp;
+
+    toAVP(avp);
+
+    return avp;
+}
+
+Diameter::AVP Diameter::AVPView::toMemoizedAVP() const
+{
+    AVP avp;
+
+    toMemoizedAVP(avp);
+
+    return avp;
+}
+
+void Diameter::AVPView::toAVP(Diameter::AVP& avp) const
+{
+    // Non-const accessors drop stored wire encoding
+    avp.header() = header();
+    avp.data().setOctetString(data(), dataSize());
+}
+
+void Diameter::AVPView::toMemoizedAVP(Diameter::AVP& avp) const
+{
+    toAVP(avp);
+
+    avp.m_wire.insert(avp.m_wire.end(), m_data, m_data + paddedLength());
+}
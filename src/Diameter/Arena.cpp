@@ -0,0 +1,107 @@
+#include <Diameter/Arena.hpp>
+#include <algorithm>
+
+Diameter::Arena::Arena(std::size_t blockSize) :
+    m_blocks(),
+    m_blockSize(blockSize),
+    m_current(0),
+    m_offset(0),
+    m_allocated(0)
+{
+
+}
+
+Diameter::Arena::~Arena()
+{
+    for (auto& block : m_blocks)
+    {
+        delete[] block.data;
+    }
+}
+
+void* Diameter::Arena::allocate(std::size_t size, std::size_t alignment)
+{
+    while (true)
+    {
+        while (m_current < m_blocks.size())
+        {
+            auto& block = m_blocks[m_current];
+
+            auto address = reinterpret_cast<std::uintptr_t>(block.data) + m_offset;
+            auto padding = static_cast<std::size_t>((~address + 1) & (alignment - 1));
+
+            if (block.size - m_offset >= padding + size)
+            {
+                auto pointer = block.data + m_offset + padding;
+
+                m_offset += padding + size;
+                m_allocated += size;
+
+                return pointer;
+            }
+
+            ++m_current;
+            m_offset = 0;
+        }
+
+        addBlock(std::max(m_blockSize, size + alignment));
+    }
+}
+
+void Diameter::Arena::reset()
+{
+    // Arena had to grow, so one block of the
+    // same total size is enough next time
+    if (m_blocks.size() > 1)
+    {
+        auto total = capacity();
+
+        for (auto& block : m_blocks)
+        {
+            delete[] block.data;
+        }
+
+        m_blocks.clear();
+
+        addBlock(total);
+    }
+
+    m_current = 0;
+    m_offset = 0;
+    m_allocated = 0;
+}
+
+std::size_t Diameter::Arena::allocated() const
+{
+    return m_allocated;
+}
+
+std::size_t Diameter::Arena::capacity() const
+{
+    std::size_t result = 0;
+
+    for (auto& block : m_blocks)
+    {
+        result += block.size;
+    }
+
+    return result;
+}
+
+std::size_t Diameter::Arena::numberOfBlocks() const
+{
+    return m_blocks.size();
+}
+
+void Diameter::Arena::addBlock(std::size_t size)
+{
+    // Block is registered first, so memory
+    // is freed by destructor in any case
+    m_blocks.push_back(Block{nullptr, 0});
+
+    m_blocks.back().data = new uint8_t[size];
+    m_blocks.back().size = size;
+
+    m_current = m_blocks.size() - 1;
+    m_offset = 0;
+}
@@ -0,0 +1,96 @@
+#include <Diameter/BatchEncoder.hpp>
+#include <Diameter/Exceptions.hpp>
+
+void Diameter::BatchEncoder::encode(const Diameter::Packet* packets,
+                                    std::size_t count,
+                                    ByteArray& byteArray,
+                                    std::vector<std::size_t>& offsets,
+                                    bool checkValid)
+{
+    std::size_t length = 0;
+
+    // Headers are checked before anything is written
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto packetLength = packets[i].calculateLength();
+
+        if (checkValid &&
+            (!packets[i].m_header.isValid() || packets[i].m_header.messageLength() != packetLength))
+        {
+            DIAMETER_THROW(std::logic_error("Packet is not valid"));
+        }
+
+        length += packetLength;
+    }
+
+    auto initialSize = byteArray.size();
+    auto initialOffsets = offsets.size();
+
+    byteArray.resize(initialSize + length);
+    offsets.reserve(initialOffsets + count);
+
+    auto pointer = byteArray.data() + initialSize;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        offsets.push_back(static_cast<std::size_t>(pointer - byteArray.data()));
+
+        auto end = pointer + packets[i].calculateLength();
+
+        // AVPs are validated in the same pass
+        pointer = packets[i].write(pointer, end, checkValid);
+
+        if (pointer != end)
+        {
+            byteArray.resize(initialSize);
+            offsets.resize(initialOffsets);
+
+            DIAMETER_THROW(std::logic_error("Packet is not valid"));
+        }
+    }
+}
+
+void Diameter::BatchEncoder::encode(const std::vector<Diameter::Packet>& packets,
+                                    ByteArray& byteArray,
+                                    std::vector<std::size_t>& offsets,
+                                    bool checkValid)
+{
+    encode(packets.data(), packets.size(), byteArray, offsets, checkValid);
+}
+
+void Diameter::BatchEncoder::stamp(const Diameter::MessageTemplate& messageTemplate,
+                                   const std::vector<Diameter::MessageTemplate::SlotValue>* values,
+                                   std::size_t count,
+                                   ByteArray& byteArray,
+                                   std::vector<std::size_t>& offsets)
+{
+    std::size_t length = 0;
+
+    // Values are checked before anything is written
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        length += messageTemplate.calculateLength(values[i]);
+    }
+
+    auto initialSize = byteArray.size();
+
+    byteArray.resize(initialSize + length);
+    offsets.reserve(offsets.size() + count);
+
+    auto pointer = byteArray.data() + initialSize;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        offsets.push_back(static_cast<std::size_t>(pointer - byteArray.data()));
+
+        pointer = messageTemplate.stamp(values[i], pointer);
+    }
+}
+
+void Diameter::BatchEncoder::stamp(const Diameter::MessageTemplate& messageTemplate,
+                                   const std::vector<std::vector<Diameter::MessageTemplate::SlotValue>>& values,
+                                   ByteArray& byteArray,
+                                   std::vector<std::size_t>& offsets)
+{
+    stamp(messageTemplate, values.data(), values.size(), byteArray, offsets);
+}
@@ -0,0 +1,168 @@
+#include <Diameter/BatchParser.hpp>
+#include <Diameter/Wire.hpp>
+
+Diameter::ParseResult Diameter::BatchParser::split(const uint8_t* data,
+                                                   std::size_t size,
+                                                   std::vector<Diameter::PacketView>& views,
+                                                   std::size_t& consumed)
+{
+    auto initialSize = views.size();
+
+    auto result = walk(
+        data,
+        size,
+        consumed,
+        [&views](const PacketView& view)
+        {
+            views.push_back(view);
+        }
+    );
+
+    if (!result.isOk())
+    {
+        views.erase(views.begin() + initialSize, views.end());
+    }
+
+    return result;
+}
+
+Diameter::ParseResult Diameter::BatchParser::parse(const uint8_t* data,
+                                                   std::size_t size,
+                                                   std::vector<Diameter::Packet>& packets,
+                                                   std::size_t& consumed,
+                                                   Diameter::Packet::ParseMode mode)
+{
+    auto initialSize = packets.size();
+
+    auto result = walk(
+        data,
+        size,
+        consumed,
+        [&packets, mode](const PacketView& view)
+        {
+            packets.emplace_back(view, mode);
+        }
+    );
+
+    if (!result.isOk())
+    {
+        packets.erase(packets.begin() + initialSize, packets.end());
+    }
+
+    return result;
+}
+
+template<typename Handler>
+Diameter::ParseResult Diameter::BatchParser::walk(const uint8_t* data,
+                                                  std::size_t size,
+                                                  std::size_t& consumed,
+                                                  Handler handler)
+{
+    uint32_t offsets[BlockSize];
+    uint32_t count;
+
+    std::size_t pointer = 0;
+
+    PacketView view;
+    ParseResult result;
+
+    do
+    {
+        count = scan(data, size, pointer, offsets);
+
+        result = validateHeaders(data, offsets, count);
+
+        if (!result.isOk())
+        {
+            return result;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            auto length = Wire::readUInt24(data + offsets[i] + 1);
+
+            result = PacketView::tryParse(data + offsets[i], length, view);
+
+            if (!result.isOk())
+            {
+                return result.shifted(offsets[i]);
+            }
+
+            handler(view);
+        }
+    } while (count == BlockSize);
+
+    // Scan stopped at message with broken length
+    if (size - pointer >= Packet::Header::Size &&
+        Wire::readUInt24(data + pointer + 1) < Packet::Header::Size)
+    {
+        return ParseResult(ParseResult::Code::InvalidLength, static_cast<uint32_t>(pointer), 0);
+    }
+
+    consumed = pointer;
+
+    return result;
+}
+
+uint32_t Diameter::BatchParser::scan(const uint8_t* data,
+                                     std::size_t size,
+                                     std::size_t& pointer,
+                                     uint32_t* offsets)
+{
+    uint32_t count = 0;
+
+    while (count < BlockSize &&
+           size - pointer >= Packet::Header::Size)
+    {
+        auto length = Wire::readUInt24(data + pointer + 1);
+
+        // Broken length is reported after scan
+        if (length < Packet::Header::Size ||
+            length > size - pointer)
+        {
+            break;
+        }
+
+        offsets[count++] = static_cast<uint32_t>(pointer);
+
+        pointer += length;
+    }
+
+    return count;
+}
+
+Diameter::ParseResult Diameter::BatchParser::validateHeaders(const uint8_t* data,
+                                                             const uint32_t* offsets,
+                                                             uint32_t count)
+{
+    // Reserved bits of command flags. eg. RFC-3588
+    const uint8_t reservedFlags = 0x0F;
+
+    // Branchless accumulation over all headers.
+    // Failed header is located only if something is wrong.
+    uint32_t invalid = 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        invalid |= static_cast<uint32_t>(data[offsets[i]] ^ 1) |
+                   static_cast<uint32_t>(data[offsets[i] + 4] & reservedFlags);
+    }
+
+    if (invalid != 0)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (data[offsets[i]] != 1)
+            {
+                return ParseResult(ParseResult::Code::InvalidVersion, offsets[i], 0);
+            }
+
+            if ((data[offsets[i] + 4] & reservedFlags) != 0)
+            {
+                return ParseResult(ParseResult::Code::InvalidFlags, offsets[i], 0);
+            }
+        }
+    }
+
+    return ParseResult();
+}
@@ -0,0 +1,339 @@
+#include <Diameter/CompactPacket.hpp>
+#include <Diameter/PacketView.hpp>
+#include <Diameter/Wire.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <algorithm>
+#include <cstring>
+
+Diameter::CompactPacket::CompactPacket() :
+    m_header(),
+    m_codes(),
+    m_vendorIds(),
+    m_flags(),
+    m_lengths(),
+    m_offsets(),
+    m_payload()
+{
+
+}
+
+Diameter::CompactPacket::CompactPacket(const uint8_t* data, std::size_t size) :
+    CompactPacket()
+{
+    auto result = tryParse(data, size, *this);
+
+    if (!result.isOk())
+    {
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+}
+
+Diameter::CompactPacket::CompactPacket(const ByteArray& byteArray) :
+    CompactPacket(byteArray.data(), byteArray.size())
+{
+
+}
+
+Diameter::CompactPacket::CompactPacket(const Diameter::Packet& packet) :
+    CompactPacket()
+{
+    m_header = packet.header();
+
+    auto numberOfAVPs = packet.numberOfAVPs();
+
+    m_codes.reserve(numberOfAVPs);
+    m_vendorIds.reserve(numberOfAVPs);
+    m_flags.reserve(numberOfAVPs);
+    m_lengths.reserve(numberOfAVPs);
+    m_offsets.reserve(numberOfAVPs);
+    m_payload.reserve(packet.calculateLength() - Packet::Header::Size);
+
+    for (uint32_t index = 0; index < numberOfAVPs; ++index)
+    {
+        addAVP(packet.avp(index));
+    }
+}
+
+Diameter::ParseResult Diameter::CompactPacket::tryParse(const uint8_t* data,
+                                                        std::size_t size,
+                                                        Diameter::CompactPacket& packet)
+{
+    PacketView view;
+
+    auto result = PacketView::tryParse(data, size, view);
+
+    if (!result.isOk())
+    {
+        return result;
+    }
+
+    auto numberOfAVPs = view.numberOfAVPs();
+
+    packet.m_header = view.header();
+    packet.clear();
+
+    packet.m_codes.reserve(numberOfAVPs);
+    packet.m_vendorIds.reserve(numberOfAVPs);
+    packet.m_flags.reserve(numberOfAVPs);
+    packet.m_lengths.reserve(numberOfAVPs);
+    packet.m_offsets.reserve(numberOfAVPs);
+    packet.m_payload.assign(data + Packet::Header::Size, data + size);
+
+    // AVPs were checked by view, so padded
+    // lengths lead from one AVP to the next
+    uint32_t offset = 0;
+
+    for (uint32_t index = 0; index < numberOfAVPs; ++index)
+    {
+        packet.record(offset);
+
+        offset += Wire::padded(packet.m_lengths.back());
+    }
+
+    return ParseResult();
+}
+
+Diameter::CompactPacket& Diameter::CompactPacket::setHeader(Diameter::Packet::Header header)
+{
+    m_header = std::move(header);
+
+    return *this;
+}
+
+const Diameter::Packet::Header& Diameter::CompactPacket::header() const
+{
+    return m_header;
+}
+
+Diameter::Packet::Header& Diameter::CompactPacket::header()
+{
+    return m_header;
+}
+
+Diameter::CompactPacket& Diameter::CompactPacket::addAVP(const Diameter::AVP& avp)
+{
+    // Recorded length is taken from AVP header
+    if (!avp.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("AVP is not valid."));
+    }
+
+    auto offset = static_cast<uint32_t>(m_payload.size());
+
+    m_payload.resize(offset + avp.calculateLength(true));
+
+    avp.deploy(m_payload.data() + offset);
+
+    record(offset);
+
+    return *this;
+}
+
+void Diameter::CompactPacket::record(uint32_t offset)
+{
+    auto data = m_payload.data() + offset;
+    auto flags = data[4];
+
+    m_codes.push_back(Wire::readUInt32(data));
+    m_flags.push_back(flags);
+    m_lengths.push_back(Wire::readUInt24(data + 5));
+    m_vendorIds.push_back(
+        (flags & static_cast<uint8_t>(AVP::Header::Flags::Bits::VendorSpecific)) ?
+        Wire::readUInt32(data + 8) :
+        0
+    );
+    m_offsets.push_back(offset);
+}
+
+uint32_t Diameter::CompactPacket::numberOfAVPs() const
+{
+    return static_cast<uint32_t>(m_codes.size());
+}
+
+Diameter::AVPView Diameter::CompactPacket::avp(uint32_t index) const
+{
+    if (index >= m_codes.size())
+    {
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
+    }
+
+    auto offset = m_offsets[index];
+
+    return AVPView(m_payload.data() + offset, m_payload.size() - offset);
+}
+
+Diameter::AVP::Header::AVPCodeType Diameter::CompactPacket::avpCode(uint32_t index) const
+{
+    return m_codes[index];
+}
+
+Diameter::AVP::Header::VendorIdType Diameter::CompactPacket::vendorId(uint32_t index) const
+{
+    return m_vendorIds[index];
+}
+
+Diameter::AVP::Header::Flags Diameter::CompactPacket::flags(uint32_t index) const
+{
+    return AVP::Header::Flags(m_flags[index]);
+}
+
+Diameter::AVP::Header::LengthType Diameter::CompactPacket::length(uint32_t index) const
+{
+    return m_lengths[index];
+}
+
+uint32_t Diameter::CompactPacket::find(Diameter::AVP::Header::AVPCodeType code,
+                                       Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    auto size = m_codes.size();
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        if (m_codes[index] == code &&
+            m_vendorIds[index] == vendorId)
+        {
+            return static_cast<uint32_t>(index);
+        }
+    }
+
+    return Packet::NoAVP;
+}
+
+std::vector<uint32_t> Diameter::CompactPacket::findAll(Diameter::AVP::Header::AVPCodeType code,
+                                                       Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    std::vector<uint32_t> result;
+
+    auto size = m_codes.size();
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        if (m_codes[index] == code &&
+            m_vendorIds[index] == vendorId)
+        {
+            result.push_back(static_cast<uint32_t>(index));
+        }
+    }
+
+    return result;
+}
+
+Diameter::AVPView::Iterator Diameter::CompactPacket::begin() const
+{
+    return AVPView::Iterator(m_payload.data(), m_payload.data() + m_payload.size());
+}
+
+Diameter::AVPView::Iterator Diameter::CompactPacket::end() const
+{
+    return AVPView::Iterator(m_payload.data() + m_payload.size(), m_payload.data() + m_payload.size());
+}
+
+bool Diameter::CompactPacket::isValid() const
+{
+    if (!m_header.isValid())
+    {
+        return false;
+    }
+
+    auto valid = std::all_of(
+        m_flags.begin(),
+        m_flags.end(),
+        [](AVP::Header::Flags::Type flags)
+        {
+            return AVP::Header::Flags(flags).isValid();
+        }
+    );
+
+    if (!valid || m_header.messageLength() != calculateLength())
+    {
+        return false;
+    }
+
+    auto size = m_offsets.size();
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        auto headerSize =
+            (m_flags[index] & static_cast<uint8_t>(AVP::Header::Flags::Bits::VendorSpecific)) ?
+            AVP::Header::MaxSize :
+            AVP::Header::MinSize;
+
+        auto next = index + 1 < size ?
+                    m_offsets[index + 1] :
+                    static_cast<uint32_t>(m_payload.size());
+
+        if (m_lengths[index] < headerSize ||
+            Wire::padded(m_lengths[index]) != next - m_offsets[index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Diameter::Packet::Header::MessageLengthType Diameter::CompactPacket::calculateLength() const
+{
+    return static_cast<Packet::Header::MessageLengthType>(Packet::Header::Size + m_payload.size());
+}
+
+Diameter::CompactPacket& Diameter::CompactPacket::updateLength()
+{
+    m_header.setMessageLength(calculateLength());
+
+    return *this;
+}
+
+Diameter::CompactPacket& Diameter::CompactPacket::clear()
+{
+    m_codes.clear();
+    m_vendorIds.clear();
+    m_flags.clear();
+    m_lengths.clear();
+    m_offsets.clear();
+    m_payload.clear();
+
+    return *this;
+}
+
+ByteArray Diameter::CompactPacket::deploy(bool checkValid) const
+{
+    ByteArray byteArray;
+
+    deploy(byteArray, checkValid);
+
+    return byteArray;
+}
+
+void Diameter::CompactPacket::deploy(ByteArray& byteArray, bool checkValid) const
+{
+    if (checkValid && !isValid())
+    {
+        DIAMETER_THROW(std::logic_error("Packet is not valid"));
+    }
+
+    auto offset = byteArray.size();
+
+    byteArray.resize(offset + calculateLength());
+
+    auto data = m_header.deploy(byteArray.data() + offset);
+
+    if (!m_payload.empty())
+    {
+        std::memcpy(data, m_payload.data(), m_payload.size());
+    }
+}
+
+Diameter::Packet Diameter::CompactPacket::toPacket() const
+{
+    Packet packet;
+
+    packet.setHeader(m_header);
+
+    for (auto avp : *this)
+    {
+        packet.addAVP(avp.toAVP());
+    }
+
+    return packet;
+}
@@ -0,0 +1,248 @@
+#include <Diameter/Encoder.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
+#include <cstring>
+
+Diameter::Encoder::Encoder(uint8_t* data, std::size_t capacity) :
+    m_data(data),
+    m_capacity(capacity),
+    m_size(0),
+    m_scopes(),
+    m_depth(0),
+    m_message(false)
+{
+
+}
+
+Diameter::Encoder& Diameter::Encoder::beginMessage(const Diameter::Packet::Header& header)
+{
+    if (m_depth != 0)
+    {
+        DIAMETER_THROW(std::invalid_argument("Message can't be started inside of another scope."));
+    }
+
+    if (!header.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("Packet header is invalid."));
+    }
+
+    auto offset = m_size;
+
+    header.deploy(reserve(Packet::Header::Size));
+
+    m_scopes[m_depth++] = offset;
+    m_message = true;
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::endMessage()
+{
+    if (!m_message || m_depth != 1)
+    {
+        DIAMETER_THROW(std::invalid_argument("There is no message to finish or grouped AVP is not finished."));
+    }
+
+    close(1);
+
+    m_message = false;
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::beginGrouped(Diameter::AVP::Header::AVPCodeType code,
+                                                   Diameter::AVP::Header::Flags flags,
+                                                   Diameter::AVP::Header::VendorIdType vendorId)
+{
+    if (m_depth == MaxDepth)
+    {
+        DIAMETER_THROW(std::invalid_argument("Too deep nesting."));
+    }
+
+    auto offset = m_size;
+
+    putHeader(code, flags, vendorId, 0);
+
+    m_scopes[m_depth++] = offset;
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::endGrouped()
+{
+    if (m_depth == (m_message ? 1u : 0u))
+    {
+        DIAMETER_THROW(std::invalid_argument("There is no grouped AVP to finish."));
+    }
+
+    close(5);
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::putOctetString(Diameter::AVP::Header::AVPCodeType code,
+                                                     const uint8_t* data,
+                                                     std::size_t size,
+                                                     Diameter::AVP::Header::Flags flags,
+                                                     Diameter::AVP::Header::VendorIdType vendorId)
+{
+    if (size > 0xFFFFFF - AVP::Header::MaxSize)
+    {
+        DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+    }
+
+    auto value = putHeader(code, flags, vendorId, static_cast<uint32_t>(size));
+
+    if (size != 0)
+    {
+        std::memcpy(value, data, size);
+    }
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::putOctetString(Diameter::AVP::Header::AVPCodeType code,
+                                                     const ByteArray& value,
+                                                     Diameter::AVP::Header::Flags flags,
+                                                     Diameter::AVP::Header::VendorIdType vendorId)
+{
+    return putOctetString(code, value.data(), value.size(), flags, vendorId);
+}
+
+Diameter::Encoder& Diameter::Encoder::putInteger32(Diameter::AVP::Header::AVPCodeType code,
+                                                   int32_t value,
+                                                   Diameter::AVP::Header::Flags flags,
+                                                   Diameter::AVP::Header::VendorIdType vendorId)
+{
+    return putUnsigned32(code, static_cast<uint32_t>(value), flags, vendorId);
+}
+
+Diameter::Encoder& Diameter::Encoder::putInteger64(Diameter::AVP::Header::AVPCodeType code,
+                                                   int64_t value,
+                                                   Diameter::AVP::Header::Flags flags,
+                                                   Diameter::AVP::Header::VendorIdType vendorId)
+{
+    return putUnsigned64(code, static_cast<uint64_t>(value), flags, vendorId);
+}
+
+Diameter::Encoder& Diameter::Encoder::putUnsigned32(Diameter::AVP::Header::AVPCodeType code,
+                                                    uint32_t value,
+                                                    Diameter::AVP::Header::Flags flags,
+                                                    Diameter::AVP::Header::VendorIdType vendorId)
+{
+    Wire::writeUInt32(putHeader(code, flags, vendorId, sizeof(value)), value);
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::putUnsigned64(Diameter::AVP::Header::AVPCodeType code,
+                                                    uint64_t value,
+                                                    Diameter::AVP::Header::Flags flags,
+                                                    Diameter::AVP::Header::VendorIdType vendorId)
+{
+    Wire::writeUInt64(putHeader(code, flags, vendorId, sizeof(value)), value);
+
+    return *this;
+}
+
+Diameter::Encoder& Diameter::Encoder::putAVP(const Diameter::AVP& avp)
+{
+    if (!avp.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("AVP is invalid."));
+    }
+
+    avp.deploy(reserve(avp.calculateLength(true)));
+
+    return *this;
+}
+
+std::size_t Diameter::Encoder::size() const
+{
+    return m_size;
+}
+
+uint32_t Diameter::Encoder::depth() const
+{
+    return m_depth;
+}
+
+Diameter::Encoder& Diameter::Encoder::reset()
+{
+    m_size = 0;
+    m_depth = 0;
+    m_message = false;
+
+    return *this;
+}
+
+uint8_t* Diameter::Encoder::reserve(std::size_t size)
+{
+    if (size > m_capacity - m_size)
+    {
+        DIAMETER_THROW(std::invalid_argument("Not enough space in buffer."));
+    }
+
+    auto pointer = m_data + m_size;
+
+    m_size += size;
+
+    return pointer;
+}
+
+uint8_t* Diameter::Encoder::putHeader(Diameter::AVP::Header::AVPCodeType code,
+                                      Diameter::AVP::Header::Flags flags,
+                                      Diameter::AVP::Header::VendorIdType vendorId,
+                                      uint32_t size)
+{
+    if (!flags.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("Reserved AVP flags are set."));
+    }
+
+    if (vendorId != 0)
+    {
+        flags.setFlag(AVP::Header::Flags::Bits::VendorSpecific, true);
+    }
+
+    uint32_t headerSize = AVP::Header::MinSize;
+
+    if (flags.isSet(AVP::Header::Flags::Bits::VendorSpecific))
+    {
+        headerSize = AVP::Header::MaxSize;
+    }
+
+    auto length = headerSize + size;
+    auto padded = Wire::padded(length);
+
+    auto pointer = reserve(padded);
+
+    Wire::writeUInt32(pointer, code);
+    pointer[4] = flags.deploy();
+    Wire::writeUInt24(pointer + 5, length);
+
+    if (headerSize == AVP::Header::MaxSize)
+    {
+        Wire::writeUInt32(pointer + 8, vendorId);
+    }
+
+    // Padding is zeroed here, value is written by caller
+    std::memset(pointer + length, 0, padded - length);
+
+    return pointer + headerSize;
+}
+
+void Diameter::Encoder::close(uint32_t lengthOffset)
+{
+    auto offset = m_scopes[m_depth - 1];
+    auto length = m_size - offset;
+
+    if (length > 0xFFFFFF)
+    {
+        DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+    }
+
+    --m_depth;
+
+    Wire::writeUInt24(m_data + offset + lengthOffset, static_cast<uint32_t>(length));
+}
@@ -0,0 +1,100 @@
+#include <Diameter/HeaderPatcher.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
+
+Diameter::HeaderPatcher::HeaderPatcher(uint8_t* data, std::size_t size) :
+    m_data(data),
+    m_size(size)
+{
+    if (size < Packet::Header::Size)
+    {
+        DIAMETER_THROW(std::invalid_argument("Can't patch packet header: Data is too small."));
+    }
+
+    if (data[0] != 1)
+    {
+        DIAMETER_THROW(std::invalid_argument("Can't patch packet header: Wrong version."));
+    }
+}
+
+Diameter::HeaderPatcher::HeaderPatcher(ByteArray& byteArray) :
+    HeaderPatcher(byteArray.data(), byteArray.size())
+{
+
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setMessageLength(Diameter::Packet::Header::MessageLengthType length)
+{
+    // Message can't be longer than patched buffer
+    if (length < Packet::Header::Size ||
+        length > 0xFFFFFF ||
+        length > m_size)
+    {
+        DIAMETER_THROW(std::invalid_argument("Wrong message length."));
+    }
+
+    Wire::writeUInt24(m_data + 1, length);
+
+    return *this;
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setCommandFlags(const Diameter::Packet::Header::Flags& flags)
+{
+    if (!flags.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("Reserved command flags are set."));
+    }
+
+    m_data[4] = flags.deploy();
+
+    return *this;
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setFlag(Diameter::Packet::Header::Flags::Bits bit, bool value)
+{
+    auto mask = static_cast<uint8_t>(bit);
+
+    if (value)
+    {
+        m_data[4] |= mask;
+    }
+    else
+    {
+        m_data[4] &= static_cast<uint8_t>(~mask);
+    }
+
+    return *this;
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setCommandCode(Diameter::Packet::Header::CommandCodeType code)
+{
+    if (code > 0xFFFFFF)
+    {
+        DIAMETER_THROW(std::invalid_argument("Command code does not fit into 24 bits."));
+    }
+
+    Wire::writeUInt24(m_data + 5, code);
+
+    return *this;
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setApplicationId(Diameter::Packet::Header::ApplicationIdType id)
+{
+    Wire::writeUInt32(m_data + 8, id);
+
+    return *this;
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setHBHIdentifier(Diameter::Packet::Header::HBHType id)
+{
+    Wire::writeUInt32(m_data + 12, id);
+
+    return *this;
+}
+
+Diameter::HeaderPatcher& Diameter::HeaderPatcher::setETEIdentifier(Diameter::Packet::Header::ETEType id)
+{
+    Wire::writeUInt32(m_data + 16, id);
+
+    return *this;
+}
@@ -0,0 +1,53 @@
+#include <Diameter/InterestSet.hpp>
+#include <algorithm>
+
+Diameter::InterestSet::InterestSet() :
+    m_keys(),
+    m_filter(0)
+{
+
+}
+
+Diameter::InterestSet& Diameter::InterestSet::add(Diameter::AVP::Header::AVPCodeType code,
+                                                  Diameter::AVP::Header::VendorIdType vendorId)
+{
+    auto value = key(code, vendorId);
+
+    auto position = std::lower_bound(m_keys.begin(), m_keys.end(), value);
+
+    if (position == m_keys.end() || *position != value)
+    {
+        m_keys.insert(position, value);
+    }
+
+    m_filter |= uint64_t(1) << (code & 63);
+
+    return *this;
+}
+
+bool Diameter::InterestSet::contains(Diameter::AVP::Header::AVPCodeType code,
+                                     Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    if ((m_filter & (uint64_t(1) << (code & 63))) == 0)
+    {
+        return false;
+    }
+
+    return std::binary_search(m_keys.begin(), m_keys.end(), key(code, vendorId));
+}
+
+uint32_t Diameter::InterestSet::size() const
+{
+    return static_cast<uint32_t>(m_keys.size());
+}
+
+bool Diameter::InterestSet::empty() const
+{
+    return m_keys.empty();
+}
+
+uint64_t Diameter::InterestSet::key(Diameter::AVP::Header::AVPCodeType code,
+                                    Diameter::AVP::Header::VendorIdType vendorId)
+{
+    return (static_cast<uint64_t>(code) << 32) | vendorId;
+}
@@ -0,0 +1,432 @@
+#include <Diameter/MessageEditor.hpp>
+#include <Diameter/Packet.hpp>
+#include <Diameter/PacketView.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
+#include <cstring>
+#include <functional>
+
+const uint32_t Diameter::MessageEditor::NoAVP;
+
+Diameter::MessageEditor::MessageEditor(ByteArray& message) :
+    m_message(message),
+    m_offsets()
+{
+    PacketView view;
+
+    auto result = PacketView::tryParse(message.data(), message.size(), view);
+
+    if (!result.isOk())
+    {
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+
+    m_offsets.reserve(view.numberOfAVPs());
+
+    for (auto avp : view)
+    {
+        m_offsets.push_back(static_cast<uint32_t>(avp.raw() - view.data()));
+    }
+}
+
+uint32_t Diameter::MessageEditor::numberOfAVPs() const
+{
+    return static_cast<uint32_t>(m_offsets.size());
+}
+
+Diameter::AVPView Diameter::MessageEditor::avp(uint32_t index) const
+{
+    if (index >= m_offsets.size())
+    {
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
+    }
+
+    auto offset = m_offsets[index];
+
+    return AVPView(m_message.data() + offset, m_message.size() - offset);
+}
+
+uint32_t Diameter::MessageEditor::find(Diameter::AVP::Header::AVPCodeType code,
+                                       Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    for (uint32_t index = 0; index < m_offsets.size(); ++index)
+    {
+        if (matches(m_offsets[index], code, vendorId))
+        {
+            return index;
+        }
+    }
+
+    return NoAVP;
+}
+
+Diameter::AVPView Diameter::MessageEditor::avp(const Diameter::AVPPath& path) const
+{
+    std::vector<uint32_t> offsets;
+
+    if (!locate(path, offsets))
+    {
+        DIAMETER_THROW(std::invalid_argument("There is no AVP with this path."));
+    }
+
+    auto offset = offsets.back();
+
+    return AVPView(m_message.data() + offset, m_message.size() - offset);
+}
+
+bool Diameter::MessageEditor::contains(const Diameter::AVPPath& path) const
+{
+    std::vector<uint32_t> offsets;
+
+    return locate(path, offsets);
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::setValue(const Diameter::AVPPath& path,
+                                                           const uint8_t* data,
+                                                           std::size_t size)
+{
+    std::vector<uint32_t> offsets;
+
+    if (!locate(path, offsets))
+    {
+        DIAMETER_THROW(std::invalid_argument("There is no AVP with this path."));
+    }
+
+    auto offset = offsets.back();
+    auto target = AVPView(m_message.data() + offset, m_message.size() - offset);
+
+    auto headerSize = target.headerSize();
+    auto oldPadded = target.paddedLength();
+    auto newLength = headerSize + size;
+    auto newPadded = Wire::padded(static_cast<uint32_t>(newLength));
+
+    // Every length grows by the same padded delta
+    auto delta = static_cast<int64_t>(newPadded) - static_cast<int64_t>(oldPadded);
+
+    if (newLength > 0xFFFFFF ||
+        static_cast<int64_t>(m_message.size()) + delta > 0xFFFFFF)
+    {
+        DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+    }
+
+    for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+    {
+        auto length = Wire::readUInt24(m_message.data() + offsets[i] + 5);
+
+        if (static_cast<int64_t>(length) + delta > 0xFFFFFF)
+        {
+            DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+        }
+    }
+
+    // Value of this message is moved or freed by resize,
+    // so it's copied out first
+    std::vector<uint8_t> copy;
+
+    if (size != 0 && isInside(data))
+    {
+        copy.assign(data, data + size);
+        data = copy.data();
+    }
+
+    // One move of everything after target
+    auto tail = offset + oldPadded;
+    auto tailSize = m_message.size() - tail;
+
+    if (delta > 0)
+    {
+        m_message.resize(m_message.size() + static_cast<std::size_t>(delta));
+    }
+
+    std::memmove(
+        m_message.data() + offset + newPadded,
+        m_message.data() + tail,
+        tailSize
+    );
+
+    if (delta < 0)
+    {
+        m_message.resize(m_message.size() - static_cast<std::size_t>(-delta));
+    }
+
+    auto value = m_message.data() + offset + headerSize;
+
+    if (size != 0)
+    {
+        std::memcpy(value, data, size);
+    }
+
+    std::memset(value + size, 0, newPadded - newLength);
+
+    Wire::writeUInt24(m_message.data() + offset + 5, static_cast<uint32_t>(newLength));
+
+    for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+    {
+        auto length = Wire::readUInt24(m_message.data() + offsets[i] + 5);
+
+        Wire::writeUInt24(
+            m_message.data() + offsets[i] + 5,
+            static_cast<uint32_t>(static_cast<int64_t>(length) + delta)
+        );
+    }
+
+    // Shifting top-level AVPs after edited one
+    for (auto& topLevel : m_offsets)
+    {
+        if (topLevel > offsets.front())
+        {
+            topLevel = static_cast<uint32_t>(static_cast<int64_t>(topLevel) + delta);
+        }
+    }
+
+    updateLength();
+
+    return *this;
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::setValue(const Diameter::AVPPath& path, const ByteArray& value)
+{
+    return setValue(path, value.data(), value.size());
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::appendAVP(const Diameter::AVP& avp)
+{
+    return insertAVP(numberOfAVPs(), avp);
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::appendAVP(const Diameter::AVPView& avp)
+{
+    return insertAVP(numberOfAVPs(), avp);
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::insertAVP(uint32_t index, const Diameter::AVP& avp)
+{
+    // Gap is sized by AVP header length
+    if (!avp.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("AVP is not valid."));
+    }
+
+    auto gap = openGap(index, avp.calculateLength(true));
+
+    avp.deploy(gap);
+
+    return *this;
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::insertAVP(uint32_t index, const Diameter::AVPView& avp)
+{
+    auto size = avp.paddedLength();
+
+    // Message is reallocated by gap, so AVP of
+    // this message is copied out first
+    if (isInside(avp.raw()))
+    {
+        std::vector<uint8_t> copy(avp.raw(), avp.raw() + size);
+
+        std::memcpy(openGap(index, size), copy.data(), size);
+
+        return *this;
+    }
+
+    std::memcpy(openGap(index, size), avp.raw(), size);
+
+    return *this;
+}
+
+Diameter::MessageEditor& Diameter::MessageEditor::removeAVP(uint32_t index)
+{
+    auto size = avp(index).paddedLength();
+    auto offset = m_offsets[index];
+
+    m_message.erase(
+        m_message.begin() + offset,
+        m_message.begin() + offset + size
+    );
+
+    m_offsets.erase(m_offsets.begin() + index);
+
+    for (auto i = index; i < m_offsets.size(); ++i)
+    {
+        m_offsets[i] -= size;
+    }
+
+    updateLength();
+
+    return *this;
+}
+
+uint32_t Diameter::MessageEditor::removeAll(Diameter::AVP::Header::AVPCodeType code,
+                                            Diameter::AVP::Header::VendorIdType vendorId)
+{
+    uint32_t removed = 0;
+    uint32_t target = Packet::Header::Size;
+    uint32_t kept = 0;
+
+    // Compacting kept AVPs towards beginning in one pass
+    for (uint32_t index = 0; index < m_offsets.size(); ++index)
+    {
+        auto offset = m_offsets[index];
+        auto size = avp(index).paddedLength();
+
+        if (matches(offset, code, vendorId))
+        {
+            ++removed;
+            continue;
+        }
+
+        if (target != offset)
+        {
+            std::memmove(m_message.data() + target, m_message.data() + offset, size);
+        }
+
+        m_offsets[kept++] = target;
+        target += size;
+    }
+
+    if (removed == 0)
+    {
+        return 0;
+    }
+
+    m_offsets.resize(kept);
+    m_message.resize(target);
+
+    updateLength();
+
+    return removed;
+}
+
+uint8_t* Diameter::MessageEditor::openGap(uint32_t index, uint32_t size)
+{
+    if (index > m_offsets.size())
+    {
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
+    }
+
+    if (m_message.size() + size > 0xFFFFFF)
+    {
+        DIAMETER_THROW(std::invalid_argument("Message length does not fit into 24 bits."));
+    }
+
+    auto offset = index == m_offsets.size() ?
+                  static_cast<uint32_t>(m_message.size()) :
+                  m_offsets[index];
+
+    m_message.insert(m_message.begin() + offset, size, 0);
+
+    for (auto i = index; i < m_offsets.size(); ++i)
+    {
+        m_offsets[i] += size;
+    }
+
+    m_offsets.insert(m_offsets.begin() + index, offset);
+
+    updateLength();
+
+    return m_message.data() + offset;
+}
+
+bool Diameter::MessageEditor::locate(const Diameter::AVPPath& path, std::vector<uint32_t>& offsets) const
+{
+    offsets.clear();
+
+    if (path.empty())
+    {
+        return false;
+    }
+
+    auto& steps = path.steps();
+
+    // Top-level AVP
+    uint32_t occurrence = 0;
+
+    for (auto offset : m_offsets)
+    {
+        if (matches(offset, steps[0].code, steps[0].vendorId) &&
+            occurrence++ == steps[0].occurrence)
+        {
+            offsets.push_back(offset);
+            break;
+        }
+    }
+
+    if (offsets.empty())
+    {
+        return false;
+    }
+
+    // Walking children of grouped AVPs
+    for (std::size_t i = 1; i < steps.size(); ++i)
+    {
+        auto parent = AVPView(m_message.data() + offsets.back(), m_message.size() - offsets.back());
+
+        auto pointer = parent.data();
+        auto end = parent.data() + parent.dataSize();
+
+        occurrence = 0;
+
+        auto found = false;
+
+        AVPView child;
+
+        while (pointer < end)
+        {
+            if (!AVPView::tryParse(pointer, static_cast<std::size_t>(end - pointer), child).isOk())
+            {
+                // Not a grouped AVP
+                return false;
+            }
+
+            auto offset = static_cast<uint32_t>(pointer - m_message.data());
+
+            if (matches(offset, steps[i].code, steps[i].vendorId) &&
+                occurrence++ == steps[i].occurrence)
+            {
+                offsets.push_back(offset);
+                found = true;
+                break;
+            }
+
+            pointer += child.paddedLength();
+        }
+
+        if (!found)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Diameter::MessageEditor::isInside(const uint8_t* data) const
+{
+    std::less<const uint8_t*> less;
+
+    return !less(data, m_message.data()) &&
+           less(data, m_message.data() + m_message.size());
+}
+
+void Diameter::MessageEditor::updateLength()
+{
+    Wire::writeUInt24(m_message.data() + 1, static_cast<uint32_t>(m_message.size()));
+}
+
+bool Diameter::MessageEditor::matches(uint32_t offset,
+                                      Diameter::AVP::Header::AVPCodeType code,
+                                      Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    auto data = m_message.data() + offset;
+
+    if (Wire::readUInt32(data) != code)
+    {
+        return false;
+    }
+
+    auto vendorSpecific = (data[4] & static_cast<uint8_t>(AVP::Header::Flags::Bits::VendorSpecific)) != 0;
+
+    return vendorSpecific ?
+           Wire::readUInt32(data + 8) == vendorId :
+           vendorId == 0;
+}
@@ -0,0 +1,266 @@
+#include <Diameter/MessageTemplate.hpp>
+#include <Diameter/MessageEditor.hpp>
+#include <Diameter/AVPView.hpp>
+#include <Diameter/Wire.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+Diameter::MessageTemplate::MessageTemplate(const Diameter::Packet& prototype) :
+    m_prototype(),
+    m_slots(),
+    m_order(),
+    m_fixups()
+{
+    if (!prototype.isValid())
+    {
+        DIAMETER_THROW(std::invalid_argument("Prototype is not valid."));
+    }
+
+    prototype.deploy(m_prototype, false);
+
+    rebuild();
+}
+
+uint32_t Diameter::MessageTemplate::addSlot(const Diameter::AVPPath& path)
+{
+    if (m_slots.size() == MaxSlots)
+    {
+        DIAMETER_THROW(std::invalid_argument("Too many slots."));
+    }
+
+    std::vector<uint32_t> offsets;
+
+    if (!MessageEditor(m_prototype).locate(path, offsets))
+    {
+        DIAMETER_THROW(std::invalid_argument("There is no AVP with this path."));
+    }
+
+    auto offset = offsets.back();
+    auto target = AVPView(m_prototype.data() + offset, m_prototype.size() - offset);
+
+    for (auto& slot : m_slots)
+    {
+        if (offset < slot.offset + slot.paddedLength &&
+            slot.offset < offset + target.paddedLength())
+        {
+            DIAMETER_THROW(std::invalid_argument("Slot overlaps another slot."));
+        }
+    }
+
+    offsets.pop_back();
+
+    m_slots.push_back(Slot{offset, target.headerSize(), target.paddedLength(), std::move(offsets)});
+
+    rebuild();
+
+    return static_cast<uint32_t>(m_slots.size() - 1);
+}
+
+uint32_t Diameter::MessageTemplate::numberOfSlots() const
+{
+    return static_cast<uint32_t>(m_slots.size());
+}
+
+const ByteArray& Diameter::MessageTemplate::prototype() const
+{
+    return m_prototype;
+}
+
+std::size_t Diameter::MessageTemplate::calculateLength(const std::vector<Diameter::MessageTemplate::SlotValue>& values) const
+{
+    int64_t shifts[MaxSlots + 1];
+
+    return prepare(values, shifts);
+}
+
+ByteArray Diameter::MessageTemplate::stamp(const std::vector<Diameter::MessageTemplate::SlotValue>& values) const
+{
+    ByteArray result;
+
+    stamp(values, result);
+
+    return result;
+}
+
+void Diameter::MessageTemplate::stamp(const std::vector<Diameter::MessageTemplate::SlotValue>& values,
+                                      ByteArray& byteArray) const
+{
+    int64_t shifts[MaxSlots + 1];
+
+    auto length = prepare(values, shifts);
+
+    auto offset = byteArray.size();
+
+    byteArray.resize(offset + length);
+
+    write(values, shifts, byteArray.data() + offset);
+}
+
+uint8_t* Diameter::MessageTemplate::stamp(const std::vector<Diameter::MessageTemplate::SlotValue>& values,
+                                          uint8_t* data) const
+{
+    int64_t shifts[MaxSlots + 1];
+
+    prepare(values, shifts);
+
+    return write(values, shifts, data);
+}
+
+void Diameter::MessageTemplate::rebuild()
+{
+    m_order.resize(m_slots.size());
+
+    for (uint32_t i = 0; i < m_order.size(); ++i)
+    {
+        m_order[i] = i;
+    }
+
+    std::sort(
+        m_order.begin(),
+        m_order.end(),
+        [this](uint32_t lhs, uint32_t rhs)
+        {
+            return m_slots[lhs].offset < m_slots[rhs].offset;
+        }
+    );
+
+    // Number of slots, that start before offset
+    auto position = [this](uint32_t offset) -> uint32_t
+    {
+        uint32_t result = 0;
+
+        while (result < m_order.size() &&
+               m_slots[m_order[result]].offset < offset)
+        {
+            ++result;
+        }
+
+        return result;
+    };
+
+    std::vector<uint32_t> ancestors;
+
+    for (auto& slot : m_slots)
+    {
+        ancestors.insert(ancestors.end(), slot.ancestors.begin(), slot.ancestors.end());
+    }
+
+    std::sort(ancestors.begin(), ancestors.end());
+    ancestors.erase(std::unique(ancestors.begin(), ancestors.end()), ancestors.end());
+
+    m_fixups.clear();
+
+    // Message length encloses every slot
+    m_fixups.push_back(
+        Fixup{
+            1,
+            static_cast<uint32_t>(m_prototype.size()),
+            0,
+            static_cast<uint32_t>(m_order.size())
+        }
+    );
+
+    for (auto offset : ancestors)
+    {
+        auto ancestor = AVPView(m_prototype.data() + offset, m_prototype.size() - offset);
+
+        m_fixups.push_back(
+            Fixup{
+                offset + 5,
+                ancestor.length(),
+                position(offset),
+                position(offset + ancestor.paddedLength())
+            }
+        );
+    }
+}
+
+std::size_t Diameter::MessageTemplate::prepare(const std::vector<Diameter::MessageTemplate::SlotValue>& values,
+                                               int64_t* shifts) const
+{
+    if (values.size() != m_slots.size())
+    {
+        DIAMETER_THROW(std::invalid_argument("Number of values differs from number of slots."));
+    }
+
+    shifts[0] = 0;
+
+    for (std::size_t i = 0; i < m_order.size(); ++i)
+    {
+        auto& slot = m_slots[m_order[i]];
+        auto size = values[m_order[i]].size();
+
+        if (size > 0xFFFFFF)
+        {
+            DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+        }
+
+        auto padded = Wire::padded(static_cast<uint32_t>(slot.headerSize + size));
+
+        shifts[i + 1] = shifts[i] + static_cast<int64_t>(padded) - static_cast<int64_t>(slot.paddedLength);
+    }
+
+    auto length = static_cast<int64_t>(m_prototype.size()) + shifts[m_order.size()];
+
+    if (length > 0xFFFFFF)
+    {
+        DIAMETER_THROW(std::invalid_argument("Length does not fit into 24 bits."));
+    }
+
+    return static_cast<std::size_t>(length);
+}
+
+uint8_t* Diameter::MessageTemplate::write(const std::vector<Diameter::MessageTemplate::SlotValue>& values,
+                                          const int64_t* shifts,
+                                          uint8_t* data) const
+{
+    auto prototype = m_prototype.data();
+    auto pointer = data;
+
+    uint32_t position = 0;
+
+    for (auto index : m_order)
+    {
+        auto& slot = m_slots[index];
+        auto& value = values[index];
+
+        // Prototype up to slot value, including AVP header
+        auto valueOffset = slot.offset + slot.headerSize;
+
+        std::memcpy(pointer, prototype + position, valueOffset - position);
+        pointer += valueOffset - position;
+
+        auto length = static_cast<uint32_t>(slot.headerSize + value.size());
+
+        Wire::writeUInt24(pointer - slot.headerSize + 5, length);
+
+        if (value.size() != 0)
+        {
+            std::memcpy(pointer, value.data(), value.size());
+        }
+
+        pointer += value.size();
+
+        auto padding = Wire::padded(length) - length;
+
+        std::memset(pointer, 0, padding);
+        pointer += padding;
+
+        position = slot.offset + slot.paddedLength;
+    }
+
+    std::memcpy(pointer, prototype + position, m_prototype.size() - position);
+    pointer += m_prototype.size() - position;
+
+    for (auto& fixup : m_fixups)
+    {
+        Wire::writeUInt24(
+            data + fixup.offset + shifts[fixup.first],
+            static_cast<uint32_t>(fixup.length + shifts[fixup.last] - shifts[fixup.first])
+        );
+    }
+
+    return pointer;
+}
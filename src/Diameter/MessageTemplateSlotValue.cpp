@@ -0,0 +1,57 @@
+#include <Diameter/MessageTemplate.hpp>
+#include <Diameter/Wire.hpp>
+
+Diameter::MessageTemplate::SlotValue::SlotValue() :
+    m_data(nullptr),
+    m_size(0),
+    m_integer()
+{
+
+}
+
+Diameter::MessageTemplate::SlotValue::SlotValue(const uint8_t* data, std::size_t size) :
+    m_data(data),
+    m_size(size),
+    m_integer()
+{
+
+}
+
+Diameter::MessageTemplate::SlotValue::SlotValue(const ByteArray& value) :
+    m_data(value.data()),
+    m_size(value.size()),
+    m_integer()
+{
+
+}
+
+Diameter::MessageTemplate::SlotValue Diameter::MessageTemplate::SlotValue::fromUnsigned32(uint32_t value)
+{
+    SlotValue result;
+
+    Wire::writeUInt32(result.m_integer, value);
+    result.m_size = sizeof(value);
+
+    return result;
+}
+
+Diameter::MessageTemplate::SlotValue Diameter::MessageTemplate::SlotValue::fromUnsigned64(uint64_t value)
+{
+    SlotValue result;
+
+    Wire::writeUInt64(result.m_integer, value);
+    result.m_size = sizeof(value);
+
+    return result;
+}
+
+const uint8_t* Diameter::MessageTemplate::SlotValue::data() const
+{
+    // Integer is kept inside, so copies stay valid
+    return m_data != nullptr ? m_data : m_integer;
+}
+
+std::size_t Diameter::MessageTemplate::SlotValue::size() const
+{
+    return m_size;
+}
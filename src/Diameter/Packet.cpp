@@ -1,72 +1,272 @@
 #include <Diameter/Packet.hpp>
+#include <Diameter/PacketView.hpp>
+#include <Diameter/InterestSet.hpp>
+#include <Diameter/SegmentList.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+const uint32_t Diameter::Packet::NoAVP;
 
 Diameter::Packet::Packet() :
     m_header(),
-    m_avps()
+    m_avps(),
+    m_size(0),
+    m_source(),
+    m_offsets(),
+    m_index(),
+    m_length(Header::Size),
+    m_exposed(),
+    m_exposedFlags()
+{
+
+}
+
+Diameter::Packet::Packet(Diameter::Arena& arena) :
+    m_header(),
+    m_avps(ArenaAllocator<AVP>(&arena)),
+    m_size(0),
+    m_source(ArenaAllocator<uint8_t>(&arena)),
+    m_offsets(ArenaAllocator<uint32_t>(&arena)),
+    m_index(ArenaAllocator<IndexEntry>(&arena)),
+    m_length(Header::Size),
+    m_exposed(ArenaAllocator<uint32_t>(&arena)),
+    m_exposedFlags(ArenaAllocator<uint8_t>(&arena))
 {
 
 }
 
 Diameter::Packet::Packet(const ByteArray& byteArray) :
+    Packet(byteArray, ParseMode::Eager)
+{
+
+}
+
+Diameter::Packet::Packet(const ByteArray& byteArray, ParseMode mode) :
     m_header(),
-    m_avps()
+    m_avps(),
+    m_size(0),
+    m_source(),
+    m_offsets(),
+    m_index(),
+    m_length(Header::Size),
+    m_exposed(),
+    m_exposedFlags()
 {
-    m_header = Header(byteArray.mid(0, Header::Size));
+    auto result = tryParse(byteArray.data(), byteArray.size(), *this, mode);
 
-    // Trying to calculate things
-    uint32_t pointer = Header::Size;
+    if (!result.isOk())
+    {
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+}
+
+Diameter::ParseResult Diameter::Packet::tryParse(const uint8_t* data,
+                                                 std::size_t size,
+                                                 Diameter::Packet& packet,
+                                                 ParseMode mode)
+{
+    // Validating everything before touching packet,
+    // so failure path does not allocate
+    PacketView view;
+
+    auto result = PacketView::tryParse(data, size, view);
 
-    while (pointer < byteArray.size())
+    if (!result.isOk())
     {
-        // Trying to read AVP length
-        if (pointer + AVP::Header::MinSize >= byteArray.size())
-        {
-            throw std::invalid_argument("Data has no any AVPs");
-        }
+        return result;
+    }
 
-        AVP::Header header(
-            byteArray.mid(
-                pointer,
-                AVP::Header::MinSize
-            )
-        );
+    packet.assign(view, mode);
+
+    return result;
+}
+
+Diameter::Packet::Packet(const ByteArray& byteArray, const Diameter::InterestSet& interests) :
+    m_header(),
+    m_avps(),
+    m_size(0),
+    m_source(),
+    m_offsets(),
+    m_index(),
+    m_length(Header::Size),
+    m_exposed(),
+    m_exposedFlags()
+{
+    auto result = tryParse(byteArray.data(), byteArray.size(), *this, interests);
+
+    if (!result.isOk())
+    {
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+}
+
+Diameter::ParseResult Diameter::Packet::tryParse(const uint8_t* data,
+                                                 std::size_t size,
+                                                 Diameter::Packet& packet,
+                                                 const Diameter::InterestSet& interests)
+{
+    PacketView view;
+
+    auto result = PacketView::tryParse(data, size, view);
+
+    if (!result.isOk())
+    {
+        return result;
+    }
+
+    packet.assign(view, ParseMode::Lazy, &interests);
+
+    return result;
+}
+
+Diameter::Packet::Packet(const Diameter::PacketView& view, ParseMode mode) :
+    m_header(),
+    m_avps(),
+    m_size(0),
+    m_source(),
+    m_offsets(),
+    m_index(),
+    m_length(Header::Size),
+    m_exposed(),
+    m_exposedFlags()
+{
+    assign(view, mode);
+}
 
-        auto realLength = header.length();
+void Diameter::Packet::assign(const Diameter::PacketView& view,
+                              ParseMode mode,
+                              const Diameter::InterestSet* interests)
+{
+    m_header = view.header();
+    m_source.clear();
+    m_offsets.clear();
+
+    if (mode == ParseMode::Lazy)
+    {
+        // Recording AVP offsets only
+        m_source.insert(m_source.end(), view.data(), view.data() + view.size());
+        m_offsets.reserve(view.numberOfAVPs());
+        reserveAVPs(view.numberOfAVPs());
 
-        // Performing /4 padding
-        realLength = (realLength + 3) & 0xFFFFFFFC;
+        uint32_t index = 0;
 
-        // Can this be size?
-        if (pointer + realLength > byteArray.size())
+        for (auto avp : view)
         {
-            throw std::invalid_argument("Data has no any AVPs");
+            auto interesting =
+                interests != nullptr &&
+                interests->contains(
+                    avp.avpCode(),
+                    avp.flags().isSet(AVP::Header::Flags::Bits::VendorSpecific) ? avp.vendorId() : 0
+                );
+
+            if (interesting)
+            {
+                avp.toAVP(m_avps[index]);
+                m_offsets.push_back(0);
+            }
+            else
+            {
+                m_offsets.push_back(static_cast<uint32_t>(avp.raw() - view.data()));
+            }
+
+            ++index;
         }
+    }
+    else
+    {
+        // Previous AVPs are overwritten in place,
+        // so their buffers are reused
+        reserveAVPs(view.numberOfAVPs());
 
-        m_avps.emplace_back(byteArray.mid(pointer, realLength));
+        auto memoize = mode == ParseMode::Memoized;
+        uint32_t index = 0;
 
-        pointer += realLength;
+        for (auto avp : view)
+        {
+            if (memoize)
+            {
+                avp.toMemoizedAVP(m_avps[index]);
+            }
+            else
+            {
+                avp.toAVP(m_avps[index]);
+            }
+
+            ++index;
+        }
     }
 
+    // View is validated up to the last padded AVP
+    m_length = static_cast<Header::MessageLengthType>(view.size());
+    m_exposed.clear();
+    m_exposedFlags.assign(m_size, 0);
+
+    buildIndex();
 }
 
 Diameter::Packet::Packet(Diameter::Packet&& moved) noexcept :
     m_header(std::move(moved.m_header)),
-    m_avps(std::move(moved.m_avps))
+    m_avps(std::move(moved.m_avps)),
+    m_size(moved.m_size),
+    m_source(std::move(moved.m_source)),
+    m_offsets(std::move(moved.m_offsets)),
+    m_index(std::move(moved.m_index)),
+    m_length(moved.m_length),
+    m_exposed(std::move(moved.m_exposed)),
+    m_exposedFlags(std::move(moved.m_exposedFlags))
 {
-
+    moved.m_size = 0;
+    moved.m_length = Header::Size;
 }
 
 Diameter::Packet::Packet(const Diameter::Packet& packet) :
     m_header(packet.m_header),
-    m_avps(packet.m_avps)
+    m_avps(packet.m_avps.begin(), packet.m_avps.begin() + packet.m_size),
+    m_size(packet.m_size),
+    m_source(packet.m_source),
+    m_offsets(packet.m_offsets),
+    m_index(packet.m_index),
+    m_length(packet.m_length),
+    m_exposed(packet.m_exposed),
+    m_exposedFlags(packet.m_exposedFlags)
 {
-
+    // Copied AVPs are not referenced by anyone
+    settle();
 }
 
 Diameter::Packet& Diameter::Packet::operator=(const Diameter::Packet& copied)
 {
     m_header = copied.m_header;
-    m_avps = copied.m_avps;
+    m_avps.assign(copied.m_avps.begin(), copied.m_avps.begin() + copied.m_size);
+    m_size = copied.m_size;
+    m_source = copied.m_source;
+    m_offsets = copied.m_offsets;
+    m_index = copied.m_index;
+    m_length = copied.m_length;
+    m_exposed = copied.m_exposed;
+    m_exposedFlags = copied.m_exposedFlags;
+
+    // Copied AVPs are not referenced by anyone
+    settle();
+
+    return *this;
+}
+
+Diameter::Packet& Diameter::Packet::reset()
+{
+    m_header = Header();
+
+    // AVPs are kept for reuse with their buffers
+    m_size = 0;
+    m_source.clear();
+    m_offsets.clear();
+    m_index.clear();
+    m_length = Header::Size;
+    m_exposed.clear();
+    m_exposedFlags.clear();
 
     return *this;
 }
@@ -90,16 +290,43 @@ Diameter::Packet::Header& Diameter::Packet::header()
 
 Diameter::Packet& Diameter::Packet::addAVP(Diameter::AVP avp)
 {
-    m_avps.emplace_back(std::move(avp));
+    settle();
+
+    if (m_size < m_avps.size())
+    {
+        m_avps[m_size] = std::move(avp);
+    }
+    else
+    {
+        m_avps.emplace_back(std::move(avp));
+    }
+
+    ++m_size;
+
+    if (!m_offsets.empty())
+    {
+        m_offsets.push_back(0);
+    }
+
+    m_exposedFlags.push_back(0);
+
+    indexAVP(m_size - 1);
+
+    m_length += paddedLength(m_size - 1);
 
     return *this;
 }
 
 Diameter::AVP Diameter::Packet::avp(uint32_t index) const
 {
-    if (index >= m_avps.size())
+    if (index >= m_size)
     {
-        throw std::invalid_argument("Wrong AVP index.");
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
+    }
+
+    if (!isDecoded(index))
+    {
+        return rawAVP(index).toAVP();
     }
 
     return m_avps[index];
@@ -107,29 +334,105 @@ Diameter::AVP Diameter::Packet::avp(uint32_t index) const
 
 Diameter::AVP& Diameter::Packet::avp(uint32_t index)
 {
-    if (index >= m_avps.size())
+    if (index >= m_size)
     {
-        throw std::invalid_argument("Wrong AVP index.");
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
     }
 
+    materialize(index);
+
+    // AVP code and length may be changed by caller
+    // while reference is alive
+    expose(index);
+
     return m_avps[index];
 }
 
 Diameter::Packet& Diameter::Packet::replaceAVP(Diameter::AVP avp, uint32_t index)
 {
-    if (index >= m_avps.size())
+    if (index >= m_size)
     {
-        throw std::invalid_argument("Wrong AVP index.");
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
     }
 
+    settle();
+
+    unindexAVP(index, false);
+
+    m_length -= paddedLength(index);
+
     m_avps[index] = std::move(avp);
 
+    if (!m_offsets.empty())
+    {
+        m_offsets[index] = 0;
+    }
+
+    m_length += paddedLength(index);
+
+    indexAVP(index);
+
     return *this;
 }
 
 uint32_t Diameter::Packet::numberOfAVPs() const
 {
-    return static_cast<uint32_t>(m_avps.size());
+    return m_size;
+}
+
+bool Diameter::Packet::isMaterialized(uint32_t index) const
+{
+    if (index >= m_size)
+    {
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
+    }
+
+    return isDecoded(index);
+}
+
+bool Diameter::Packet::isDecoded(uint32_t index) const
+{
+    return m_offsets.empty() || m_offsets[index] == 0;
+}
+
+void Diameter::Packet::reserveAVPs(uint32_t size)
+{
+    auto arena = m_avps.get_allocator().arena();
+
+    m_avps.reserve(size);
+
+    // Values of new AVPs are taken from arena too
+    while (m_avps.size() < size)
+    {
+        if (arena != nullptr)
+        {
+            m_avps.emplace_back(*arena);
+        }
+        else
+        {
+            m_avps.emplace_back();
+        }
+    }
+
+    m_size = size;
+}
+
+void Diameter::Packet::materialize(uint32_t index)
+{
+    if (isDecoded(index))
+    {
+        return;
+    }
+
+    rawAVP(index).toAVP(m_avps[index]);
+    m_offsets[index] = 0;
+}
+
+Diameter::AVPView Diameter::Packet::rawAVP(uint32_t index) const
+{
+    auto offset = m_offsets[index];
+
+    return AVPView(m_source.data() + offset, m_source.size() - offset);
 }
 
 bool Diameter::Packet::isValid() const
@@ -139,15 +442,25 @@ bool Diameter::Packet::isValid() const
         return false;
     }
 
-    for (auto&& avp : m_avps)
+    // Cached length is not trusted here, because AVP
+    // may be changed through reference after updateLength()
+    Header::MessageLengthType length = Header::Size;
+
+    for (uint32_t index = 0; index < m_size; ++index)
     {
-        if (!avp.isValid())
+        auto valid = isDecoded(index) ?
+                     m_avps[index].isValid() :
+                     rawAVP(index).isValid();
+
+        if (!valid)
         {
             return false;
         }
+
+        length += paddedLength(index);
     }
 
-    return m_header.messageLength() == calculateLength();
+    return m_header.messageLength() == length;
 
 }
 
@@ -155,25 +468,100 @@ Diameter::Packet& Diameter::Packet::operator=(Diameter::Packet&& moved) noexcept
 {
     m_header = std::move(moved.m_header);
     m_avps = std::move(moved.m_avps);
+    m_size = moved.m_size;
+    m_source = std::move(moved.m_source);
+    m_offsets = std::move(moved.m_offsets);
+    m_index = std::move(moved.m_index);
+    m_length = moved.m_length;
+    m_exposed = std::move(moved.m_exposed);
+    m_exposedFlags = std::move(moved.m_exposedFlags);
+    moved.m_size = 0;
+    moved.m_length = Header::Size;
 
     return *this;
 }
 
 Diameter::Packet::Header::MessageLengthType Diameter::Packet::calculateLength() const
 {
-    Header::MessageLengthType length = Header::Size;
+    auto length = m_length;
 
-    for (auto&& avp : m_avps)
+    for (auto index : m_exposed)
     {
-        length += avp.calculateLength(true);
+        length += paddedLength(index);
     }
 
     return length;
 }
 
+void Diameter::Packet::expose(uint32_t index)
+{
+    if (m_exposedFlags[index] != 0)
+    {
+        return;
+    }
+
+    m_length -= paddedLength(index);
+
+    // Index entry is left in place and skipped by
+    // lookups, it's dropped on settle()
+    m_exposedFlags[index] = 1;
+    m_exposed.push_back(index);
+}
+
+void Diameter::Packet::settle()
+{
+    if (m_exposed.empty())
+    {
+        return;
+    }
+
+    // Entries of exposed AVPs may be stale, because
+    // code or vendor id may be changed through reference
+    m_index.erase(
+        std::remove_if(
+            m_index.begin(),
+            m_index.end(),
+            [this](const IndexEntry& entry)
+            {
+                return m_exposedFlags[entry.index] != 0;
+            }
+        ),
+        m_index.end()
+    );
+
+    for (auto index : m_exposed)
+    {
+        m_length += paddedLength(index);
+        m_exposedFlags[index] = 0;
+    }
+
+    if (m_exposed.size() == 1)
+    {
+        indexAVP(m_exposed.front());
+    }
+    else
+    {
+        for (auto index : m_exposed)
+        {
+            m_index.push_back(indexEntry(index));
+        }
+
+        std::sort(m_index.begin(), m_index.end());
+    }
+
+    m_exposed.clear();
+}
+
+Diameter::Packet::Header::MessageLengthType Diameter::Packet::paddedLength(uint32_t index) const
+{
+    return isDecoded(index) ?
+           m_avps[index].calculateLength(true) :
+           rawAVP(index).paddedLength();
+}
+
 ByteArray Diameter::Packet::deploy(bool checkValid) const
 {
-    ByteArray result(calculateLength());
+    ByteArray result;
 
     deploy(result, checkValid);
 
@@ -181,35 +569,421 @@ ByteArray Diameter::Packet::deploy(bool checkValid) const
 }
 
 void Diameter::Packet::deploy(ByteArray& byteArray, bool checkValid) const
+{
+    auto length = calculateLength();
+
+    if (checkValid &&
+        (!m_header.isValid() || m_header.messageLength() != length))
+    {
+        DIAMETER_THROW(std::logic_error("Packet is not valid"));
+    }
+
+    // Exact size is known, so byte array grows once
+    auto offset = byteArray.size();
+
+    byteArray.resize(offset + length);
+
+    auto end = byteArray.data() + byteArray.size();
+
+    // AVPs are validated in the same pass. AVP, changed
+    // after updateLength(), makes packet shorter or longer
+    // than cached length.
+    if (write(byteArray.data() + offset, end, checkValid) != end)
+    {
+        byteArray.resize(offset);
+
+        DIAMETER_THROW(std::logic_error("Packet is not valid"));
+    }
+}
+
+uint8_t* Diameter::Packet::deploy(uint8_t* data) const
+{
+    auto end = data + calculateLength();
+
+    if (write(data, end, false) != end)
+    {
+        DIAMETER_THROW(std::logic_error("Packet does not match its length"));
+    }
+
+    return end;
+}
+
+uint8_t* Diameter::Packet::write(uint8_t* data, const uint8_t* end, bool checkValid) const
+{
+    if (end - data < static_cast<std::ptrdiff_t>(Header::Size))
+    {
+        return nullptr;
+    }
+
+    data = m_header.deploy(data);
+
+    for (uint32_t index = 0; index < m_size; ++index)
+    {
+        if (isDecoded(index))
+        {
+            auto& avp = m_avps[index];
+
+            if (checkValid && !avp.isValid())
+            {
+                return nullptr;
+            }
+
+            // AVP may be changed since length was calculated
+            if (end - data < static_cast<std::ptrdiff_t>(avp.calculateLength(true)))
+            {
+                return nullptr;
+            }
+
+            data = avp.deploy(data);
+        }
+        else
+        {
+            // Untouched AVP is copied as is
+            auto raw = rawAVP(index);
+
+            if (checkValid && !raw.isValid())
+            {
+                return nullptr;
+            }
+
+            if (end - data < static_cast<std::ptrdiff_t>(raw.paddedLength()))
+            {
+                return nullptr;
+            }
+
+            std::memcpy(data, raw.raw(), raw.paddedLength());
+
+            data += raw.paddedLength();
+        }
+    }
+
+    return data;
+}
+
+void Diameter::Packet::deploy(Diameter::SegmentList& segments, bool checkValid) const
 {
     if (checkValid)
     {
         if (!isValid())
         {
-            throw std::logic_error("Packet is not valid");
+            DIAMETER_THROW(std::logic_error("Packet is not valid"));
+        }
+    }
+
+    auto threshold = segments.threshold();
+
+    // Scratch is sized before any segment points into it
+    std::size_t scratchSize = Header::Size;
+
+    for (uint32_t index = 0; index < m_size; ++index)
+    {
+        if (isDecoded(index))
+        {
+            auto& avp = m_avps[index];
+
+            scratchSize += avp.calculateLength(true);
+
+            // Value with added AVPs is not contiguous
+            if (avp.data().data() != nullptr &&
+                avp.data().size() >= threshold)
+            {
+                scratchSize -= avp.data().size();
+            }
+        }
+        else
+        {
+            auto length = rawAVP(index).paddedLength();
+
+            if (length < threshold)
+            {
+                scratchSize += length;
+            }
         }
     }
 
-    m_header.deploy(byteArray);
+    auto cursor = segments.prepare(scratchSize);
+
+    cursor = m_header.deploy(cursor);
 
-    for (auto&& avp : m_avps)
+    for (uint32_t index = 0; index < m_size; ++index)
     {
-        avp.deploy(byteArray);
+        if (isDecoded(index))
+        {
+            auto& avp = m_avps[index];
+
+            if (avp.data().data() == nullptr ||
+                avp.data().size() < threshold)
+            {
+                cursor = avp.deploy(cursor);
+                continue;
+            }
+
+            cursor = avp.header().deploy(cursor);
+
+            segments.reference(cursor, avp.data().data(), avp.data().size());
+
+            for (auto i = avp.data().size(); i < Wire::padded(avp.data().size()); ++i)
+            {
+                *cursor++ = 0;
+            }
+        }
+        else
+        {
+            auto raw = rawAVP(index);
+
+            if (raw.paddedLength() >= threshold)
+            {
+                // Untouched AVP is referenced in source
+                segments.reference(cursor, raw.raw(), raw.paddedLength());
+            }
+            else
+            {
+                std::memcpy(cursor, raw.raw(), raw.paddedLength());
+
+                cursor += raw.paddedLength();
+            }
+        }
     }
+
+    segments.flush(cursor);
 }
 
 Diameter::Packet& Diameter::Packet::updateLength()
 {
-    m_header.setMessageLength(calculateLength());
+    settle();
+
+    m_header.setMessageLength(m_length);
 
     return (*this);
 }
 
 Diameter::Packet& Diameter::Packet::eraseAVP(uint32_t index)
 {
-    m_avps.erase(
-        m_avps.begin() + index
+    settle();
+
+    unindexAVP(index, true);
+
+    m_length -= paddedLength(index);
+
+    // Erased AVP is kept for reuse
+    std::rotate(
+        m_avps.begin() + index,
+        m_avps.begin() + index + 1,
+        m_avps.begin() + m_size
+    );
+
+    --m_size;
+
+    if (!m_offsets.empty())
+    {
+        m_offsets.erase(
+            m_offsets.begin() + index
+        );
+    }
+
+    m_exposedFlags.erase(
+        m_exposedFlags.begin() + index
     );
 
     return (*this);
 }
+
+uint32_t Diameter::Packet::find(Diameter::AVP::Header::AVPCodeType code,
+                                Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    auto range = lookup(code, vendorId);
+    auto result = NoAVP;
+
+    for (auto iterator = range.first; iterator != range.second; ++iterator)
+    {
+        if (m_exposedFlags[iterator->index] == 0)
+        {
+            result = iterator->index;
+            break;
+        }
+    }
+
+    for (auto index : m_exposed)
+    {
+        if (index < result && isExposedMatch(index, code, vendorId))
+        {
+            result = index;
+        }
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> Diameter::Packet::findAll(Diameter::AVP::Header::AVPCodeType code,
+                                                Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    auto range = lookup(code, vendorId);
+
+    std::vector<uint32_t> result;
+    result.reserve(static_cast<std::size_t>(range.second - range.first));
+
+    for (auto iterator = range.first; iterator != range.second; ++iterator)
+    {
+        if (m_exposedFlags[iterator->index] == 0)
+        {
+            result.push_back(iterator->index);
+        }
+    }
+
+    auto indexed = result.size();
+
+    for (auto index : m_exposed)
+    {
+        if (isExposedMatch(index, code, vendorId))
+        {
+            result.push_back(index);
+        }
+    }
+
+    if (result.size() != indexed)
+    {
+        std::sort(result.begin(), result.end());
+    }
+
+    return result;
+}
+
+bool Diameter::Packet::contains(Diameter::AVP::Header::AVPCodeType code,
+                                Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    auto range = lookup(code, vendorId);
+
+    for (auto iterator = range.first; iterator != range.second; ++iterator)
+    {
+        if (m_exposedFlags[iterator->index] == 0)
+        {
+            return true;
+        }
+    }
+
+    for (auto index : m_exposed)
+    {
+        if (isExposedMatch(index, code, vendorId))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Diameter::Packet::IndexEntry::operator<(const Diameter::Packet::IndexEntry& rhs) const
+{
+    if (code != rhs.code)
+    {
+        return code < rhs.code;
+    }
+
+    if (vendorId != rhs.vendorId)
+    {
+        return vendorId < rhs.vendorId;
+    }
+
+    return index < rhs.index;
+}
+
+Diameter::Packet::IndexEntry Diameter::Packet::indexEntry(uint32_t index) const
+{
+    IndexEntry entry;
+    entry.index = index;
+
+    if (isDecoded(index))
+    {
+        auto header = m_avps[index].header();
+
+        entry.code = header.avpCode();
+        entry.vendorId = header.flags().isSet(AVP::Header::Flags::Bits::VendorSpecific) ?
+                         header.vendorId() :
+                         0;
+    }
+    else
+    {
+        auto raw = rawAVP(index);
+
+        entry.code = raw.avpCode();
+        entry.vendorId = raw.flags().isSet(AVP::Header::Flags::Bits::VendorSpecific) ?
+                         raw.vendorId() :
+                         0;
+    }
+
+    return entry;
+}
+
+bool Diameter::Packet::isExposedMatch(uint32_t index,
+                                      Diameter::AVP::Header::AVPCodeType code,
+                                      Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    auto entry = indexEntry(index);
+
+    return entry.code == code && entry.vendorId == vendorId;
+}
+
+void Diameter::Packet::buildIndex()
+{
+    m_index.clear();
+    m_index.reserve(m_size);
+
+    for (uint32_t index = 0; index < m_size; ++index)
+    {
+        m_index.push_back(indexEntry(index));
+    }
+
+    std::sort(m_index.begin(), m_index.end());
+}
+
+void Diameter::Packet::indexAVP(uint32_t index)
+{
+    auto entry = indexEntry(index);
+
+    m_index.insert(
+        std::upper_bound(m_index.begin(), m_index.end(), entry),
+        entry
+    );
+}
+
+void Diameter::Packet::unindexAVP(uint32_t index, bool shift)
+{
+    auto position = std::lower_bound(m_index.begin(), m_index.end(), indexEntry(index));
+
+    if (position != m_index.end() && position->index == index)
+    {
+        m_index.erase(position);
+    }
+
+    if (shift)
+    {
+        // Removing AVP does not change order of remaining keys
+        for (auto& entry : m_index)
+        {
+            if (entry.index > index)
+            {
+                --entry.index;
+            }
+        }
+    }
+}
+
+std::pair<
+    Diameter::Packet::Storage<Diameter::Packet::IndexEntry>::const_iterator,
+    Diameter::Packet::Storage<Diameter::Packet::IndexEntry>::const_iterator
+> Diameter::Packet::lookup(Diameter::AVP::Header::AVPCodeType code,
+                           Diameter::AVP::Header::VendorIdType vendorId) const
+{
+    IndexEntry first;
+    first.code = code;
+    first.vendorId = vendorId;
+    first.index = 0;
+
+    IndexEntry last = first;
+    last.index = NoAVP;
+
+    return std::make_pair(
+        std::lower_bound(m_index.begin(), m_index.end(), first),
+        std::upper_bound(m_index.begin(), m_index.end(), last)
+    );
+}
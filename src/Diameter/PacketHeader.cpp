@@ -1,4 +1,6 @@
 #include <Diameter/Packet.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <Diameter/Wire.hpp>
 
 
 Diameter::Packet::Header::Header() :
@@ -17,18 +19,28 @@ Diameter::Packet::Header::Header() :
 Diameter::Packet::Header::Header(const ByteArray& array) :
     Header()
 {
-    if (array.size() < Size)
+    if (!peek(array.data(), array.size(), *this))
     {
-        throw std::invalid_argument("Can't parse packet header: Data is too small.");
+        DIAMETER_THROW(std::invalid_argument("Can't parse packet header: Data is too small."));
     }
+}
+
+bool Diameter::Packet::Header::peek(const uint8_t* data, std::size_t size, Diameter::Packet::Header& header)
+{
+    if (size < Size)
+    {
+        return false;
+    }
+
+    header.m_version = data[0];
+    header.m_messageLength = Wire::readUInt24(data + 1);
+    header.m_commandFlags = Flags(data[4]);
+    header.m_commandCode = Wire::readUInt24(data + 5);
+    header.m_applicationId = Wire::readUInt32(data + 8);
+    header.m_hopByHop = Wire::readUInt32(data + 12);
+    header.m_endToEnd = Wire::readUInt32(data + 16);
 
-    m_version = array.read<VersionType>(0);
-    m_messageLength = array.readPart<MessageLengthType>(1, 3);
-    m_commandFlags = Flags(array.read<Flags::Type>(4));
-    m_commandCode = array.readPart<CommandCodeType>(5, 3);
-    m_applicationId = array.read<ApplicationIdType>(8);
-    m_hopByHop = array.read<HBHType>(12);
-    m_endToEnd = array.read<ETEType>(16);
+    return true;
 }
 
 Diameter::Packet::Header::Header(Diameter::Packet::Header&& moved) noexcept :
@@ -89,7 +101,7 @@ Diameter::Packet::Header& Diameter::Packet::Header::setMessageLength(Diameter::P
 {
     if (length > 16777215)
     {
-        throw std::out_of_range("Message length value " + std::to_string(length) + " is out of range [0, 16777215]");
+        DIAMETER_THROW(std::out_of_range("Message length value " + std::to_string(length) + " is out of range [0, 16777215]"));
     }
 
     m_messageLength = length;
@@ -129,7 +141,7 @@ Diameter::Packet::Header::setCommandCode(Diameter::Packet::Header::CommandCodeTy
 {
     if (commandCode > 16777215)
     {
-        throw std::out_of_range("Command code value " + std::to_string(commandCode) + " is out of range [0, 16777215]");
+        DIAMETER_THROW(std::out_of_range("Command code value " + std::to_string(commandCode) + " is out of range [0, 16777215]"));
     }
 
     m_commandCode = commandCode;
@@ -220,7 +232,7 @@ Diameter::Packet::Header& Diameter::Packet::Header::operator=(Diameter::Packet::
 
 ByteArray Diameter::Packet::Header::deploy() const
 {
-    ByteArray result(Size);
+    ByteArray result;
 
     deploy(result);
 
@@ -229,11 +241,22 @@ ByteArray Diameter::Packet::Header::deploy() const
 
 void Diameter::Packet::Header::deploy(ByteArray& byteArray) const
 {
-    byteArray.append(m_version);
-    byteArray.appendPart(m_messageLength, 3);
-    byteArray.append(m_commandFlags.deploy());
-    byteArray.appendPart(m_commandCode, 3);
-    byteArray.append(m_applicationId);
-    byteArray.append(m_hopByHop);
-    byteArray.append(m_endToEnd);
+    auto offset = byteArray.size();
+
+    byteArray.resize(offset + Size);
+
+    deploy(byteArray.data() + offset);
+}
+
+uint8_t* Diameter::Packet::Header::deploy(uint8_t* data) const
+{
+    data[0] = m_version;
+    Wire::writeUInt24(data + 1, m_messageLength);
+    data[4] = m_commandFlags.deploy();
+    Wire::writeUInt24(data + 5, m_commandCode);
+    Wire::writeUInt32(data + 8, m_applicationId);
+    Wire::writeUInt32(data + 12, m_hopByHop);
+    Wire::writeUInt32(data + 16, m_endToEnd);
+
+    return data + Size;
 }
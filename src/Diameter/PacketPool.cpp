@@ -0,0 +1,59 @@
+#include <Diameter/PacketPool.hpp>
+
+Diameter::PacketPool::PacketPool(std::size_t capacity) :
+    m_packets(),
+    m_capacity(capacity)
+{
+    // Releasing never allocates
+    m_packets.reserve(capacity);
+}
+
+Diameter::PacketPool& Diameter::PacketPool::local()
+{
+    thread_local PacketPool pool;
+
+    return pool;
+}
+
+Diameter::Packet Diameter::PacketPool::acquire()
+{
+    if (m_packets.empty())
+    {
+        return Packet();
+    }
+
+    Packet packet(std::move(m_packets.back()));
+
+    m_packets.pop_back();
+
+    return packet;
+}
+
+void Diameter::PacketPool::release(Diameter::Packet&& packet)
+{
+    // Arena memory is released by arena reset
+    if (m_packets.size() == m_capacity ||
+        packet.m_avps.get_allocator().arena() != nullptr)
+    {
+        return;
+    }
+
+    packet.reset();
+
+    m_packets.push_back(std::move(packet));
+}
+
+std::size_t Diameter::PacketPool::size() const
+{
+    return m_packets.size();
+}
+
+std::size_t Diameter::PacketPool::capacity() const
+{
+    return m_capacity;
+}
+
+void Diameter::PacketPool::clear()
+{
+    m_packets.clear();
+}
@@ -0,0 +1,179 @@
+#include <Diameter/PacketView.hpp>
+#include <Diameter/Wire.hpp>
+#include <Diameter/Exceptions.hpp>
+
+Diameter::PacketView::PacketView() :
+    m_data(nullptr),
+    m_size(0),
+    m_numberOfAVPs(0)
+{
+
+}
+
+Diameter::PacketView::PacketView(const uint8_t* data, std::size_t size) :
+    m_data(nullptr),
+    m_size(0),
+    m_numberOfAVPs(0)
+{
+    auto result = tryParse(data, size, *this);
+
+    if (!result.isOk())
+    {
+        DIAMETER_THROW(std::invalid_argument(result.message()));
+    }
+}
+
+Diameter::ParseResult Diameter::PacketView::tryParse(const uint8_t* data, std::size_t size, Diameter::PacketView& view)
+{
+    if (size < Packet::Header::Size)
+    {
+        return ParseResult(ParseResult::Code::HeaderTooSmall, 0, 0);
+    }
+
+    // Walking AVP headers once, so iteration
+    // never meets malformed AVP
+    uint32_t numberOfAVPs = 0;
+    uint32_t pointer = Packet::Header::Size;
+
+    AVPView avp;
+
+    while (pointer < size)
+    {
+        auto result = AVPView::tryParse(data + pointer, size - pointer, avp);
+
+        if (!result.isOk())
+        {
+            return result.shifted(pointer);
+        }
+
+        pointer += avp.paddedLength();
+
+        ++numberOfAVPs;
+    }
+
+    view.m_data = data;
+    view.m_size = static_cast<uint32_t>(size);
+    view.m_numberOfAVPs = numberOfAVPs;
+
+    return ParseResult();
+}
+
+Diameter::PacketView::PacketView(const ByteArray& byteArray) :
+    PacketView(byteArray.data(), byteArray.size())
+{
+
+}
+
+Diameter::Packet::Header Diameter::PacketView::header() const
+{
+    Packet::Header header;
+
+    Packet::Header::peek(m_data, m_size, header);
+
+    return header;
+}
+
+Diameter::Packet::Header::VersionType Diameter::PacketView::version() const
+{
+    return m_data[0];
+}
+
+Diameter::Packet::Header::MessageLengthType Diameter::PacketView::messageLength() const
+{
+    return Wire::readUInt24(m_data + 1);
+}
+
+Diameter::Packet::Header::Flags Diameter::PacketView::commandFlags() const
+{
+    return Packet::Header::Flags(m_data[4]);
+}
+
+Diameter::Packet::Header::CommandCodeType Diameter::PacketView::commandCode() const
+{
+    return Wire::readUInt24(m_data + 5);
+}
+
+Diameter::Packet::Header::ApplicationIdType Diameter::PacketView::applicationId() const
+{
+    return Wire::readUInt32(m_data + 8);
+}
+
+Diameter::Packet::Header::HBHType Diameter::PacketView::hbhIdentifier() const
+{
+    return Wire::readUInt32(m_data + 12);
+}
+
+Diameter::Packet::Header::ETEType Diameter::PacketView::eteIdentifier() const
+{
+    return Wire::readUInt32(m_data + 16);
+}
+
+Diameter::AVPView Diameter::PacketView::avp(uint32_t index) const
+{
+    if (index >= m_numberOfAVPs)
+    {
+        DIAMETER_THROW(std::invalid_argument("Wrong AVP index."));
+    }
+
+    auto iterator = begin();
+
+    for (uint32_t i = 0; i < index; ++i)
+    {
+        ++iterator;
+    }
+
+    return *iterator;
+}
+
+uint32_t Diameter::PacketView::numberOfAVPs() const
+{
+    return m_numberOfAVPs;
+}
+
+Diameter::AVPView::Iterator Diameter::PacketView::begin() const
+{
+    return AVPView::Iterator(m_data + Packet::Header::Size, m_data + m_size);
+}
+
+Diameter::AVPView::Iterator Diameter::PacketView::end() const
+{
+    return AVPView::Iterator(m_data + m_size, m_data + m_size);
+}
+
+const uint8_t* Diameter::PacketView::data() const
+{
+    return m_data;
+}
+
+uint32_t Diameter::PacketView::size() const
+{
+    return m_size;
+}
+
+bool Diameter::PacketView::empty() const
+{
+    return m_data == nullptr;
+}
+
+bool Diameter::PacketView::isValid() const
+{
+    if (!header().isValid())
+    {
+        return false;
+    }
+
+    for (auto avp : *this)
+    {
+        if (!avp.isValid())
+        {
+            return false;
+        }
+    }
+
+    return messageLength() == m_size;
+}
+
+Diameter::Packet Diameter::PacketView::toPacket() const
+{
+    return Packet(*this);
+}
@@ -0,0 +1,218 @@
+#include <Diameter/ParallelDecoder.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <algorithm>
+#include <new>
+
+Diameter::ParallelDecoder::ParallelDecoder(uint32_t numberOfThreads) :
+    m_numberOfThreads(numberOfThreads),
+    m_rangeStorage(),
+    m_ranges(nullptr),
+    m_threads(),
+    m_messages(nullptr),
+    m_packets(nullptr),
+    m_results(nullptr),
+    m_mode(Packet::ParseMode::Eager),
+    m_mutex(),
+    m_startCondition(),
+    m_finishCondition(),
+    m_generation(0),
+    m_running(0),
+    m_stop(false)
+{
+    if (numberOfThreads == 0)
+    {
+        DIAMETER_THROW(std::invalid_argument("Number of threads is 0."));
+    }
+
+    // Before C++17 operator new does not respect
+    // alignment of Range, so storage is aligned manually
+    std::size_t space = (numberOfThreads + 1) * sizeof(Range);
+
+    m_rangeStorage.reset(new uint8_t[space]);
+
+    void* storage = m_rangeStorage.get();
+
+    std::align(alignof(Range), numberOfThreads * sizeof(Range), storage, space);
+
+    m_ranges = static_cast<Range*>(storage);
+
+    for (uint32_t i = 0; i < numberOfThreads; ++i)
+    {
+        new (m_ranges + i) Range();
+
+        m_ranges[i].next = 0;
+        m_ranges[i].end = 0;
+    }
+
+    // Calling thread is thread 0
+    m_threads.reserve(numberOfThreads - 1);
+
+    for (uint32_t i = 1; i < numberOfThreads; ++i)
+    {
+        m_threads.emplace_back(&ParallelDecoder::workerLoop, this, i);
+    }
+}
+
+Diameter::ParallelDecoder::~ParallelDecoder()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_startCondition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void Diameter::ParallelDecoder::decode(const std::vector<Diameter::ParallelDecoder::Message>& messages,
+                                       std::vector<Diameter::Packet>& packets,
+                                       std::vector<Diameter::ParseResult>& results,
+                                       Diameter::Packet::ParseMode mode)
+{
+    packets.clear();
+    packets.resize(messages.size());
+
+    results.clear();
+    results.resize(messages.size());
+
+    if (messages.empty())
+    {
+        return;
+    }
+
+    // Equal static ranges. Imbalance is fixed by stealing.
+    auto count = messages.size();
+
+    for (uint32_t i = 0; i < m_numberOfThreads; ++i)
+    {
+        m_ranges[i].next.store(count * i / m_numberOfThreads, std::memory_order_relaxed);
+        m_ranges[i].end = count * (i + 1) / m_numberOfThreads;
+    }
+
+    m_messages = messages.data();
+    m_packets = packets.data();
+    m_results = results.data();
+    m_mode = mode;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = m_numberOfThreads - 1;
+        ++m_generation;
+    }
+
+    m_startCondition.notify_all();
+
+    run(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_finishCondition.wait(
+        lock,
+        [this]()
+        {
+            return m_running == 0;
+        }
+    );
+}
+
+void Diameter::ParallelDecoder::decode(const std::vector<ByteArray>& messages,
+                                       std::vector<Diameter::Packet>& packets,
+                                       std::vector<Diameter::ParseResult>& results,
+                                       Diameter::Packet::ParseMode mode)
+{
+    std::vector<Message> buffers;
+    buffers.reserve(messages.size());
+
+    for (auto& message : messages)
+    {
+        buffers.push_back(Message{message.data(), message.size()});
+    }
+
+    decode(buffers, packets, results, mode);
+}
+
+uint32_t Diameter::ParallelDecoder::numberOfThreads() const
+{
+    return m_numberOfThreads;
+}
+
+void Diameter::ParallelDecoder::workerLoop(uint32_t index)
+{
+    uint64_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_startCondition.wait(
+                lock,
+                [this, generation]()
+                {
+                    return m_stop || m_generation != generation;
+                }
+            );
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        run(index);
+
+        bool last;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            last = --m_running == 0;
+        }
+
+        if (last)
+        {
+            m_finishCondition.notify_one();
+        }
+    }
+}
+
+void Diameter::ParallelDecoder::run(uint32_t index)
+{
+    drain(m_ranges[index]);
+
+    // Stealing from other threads, starting with neighbour
+    for (uint32_t i = 1; i < m_numberOfThreads; ++i)
+    {
+        drain(m_ranges[(index + i) % m_numberOfThreads]);
+    }
+}
+
+void Diameter::ParallelDecoder::drain(Diameter::ParallelDecoder::Range& range)
+{
+    while (true)
+    {
+        auto begin = range.next.fetch_add(ChunkSize, std::memory_order_relaxed);
+
+        if (begin >= range.end)
+        {
+            return;
+        }
+
+        auto end = std::min(begin + ChunkSize, range.end);
+
+        for (auto i = begin; i < end; ++i)
+        {
+            m_results[i] = Packet::tryParse(
+                m_messages[i].data,
+                m_messages[i].size,
+                m_packets[i],
+                m_mode
+            );
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include <Diameter/ParseResult.hpp>
+
+Diameter::ParseResult::ParseResult() :
+    m_code(Code::Ok),
+    m_offset(0),
+    m_avpCode(0)
+{
+
+}
+
+Diameter::ParseResult::ParseResult(Code code, uint32_t offset, uint32_t avpCode) :
+    m_code(code),
+    m_offset(offset),
+    m_avpCode(avpCode)
+{
+
+}
+
+Diameter::ParseResult::Code Diameter::ParseResult::code() const
+{
+    return m_code;
+}
+
+uint32_t Diameter::ParseResult::offset() const
+{
+    return m_offset;
+}
+
+uint32_t Diameter::ParseResult::avpCode() const
+{
+    return m_avpCode;
+}
+
+bool Diameter::ParseResult::isOk() const
+{
+    return m_code == Code::Ok;
+}
+
+const char* Diameter::ParseResult::message() const
+{
+    switch (m_code)
+    {
+    case Code::Ok:
+        return "Ok.";
+    case Code::HeaderTooSmall:
+        return "Can't parse packet header: Data is too small.";
+    case Code::AVPHeaderTooSmall:
+        return "Can't parse AVP Header: Data is too small.";
+    case Code::AVPLengthTooSmall:
+        return "Can't parse AVP: Length is smaller than header.";
+    case Code::AVPLengthTooLarge:
+        return "Can't parse AVP: Data is too small.";
+    case Code::InvalidVersion:
+        return "Can't parse packet header: Version is not 1.";
+    case Code::InvalidFlags:
+        return "Can't parse packet header: Reserved flags are set.";
+    case Code::InvalidLength:
+        return "Can't parse packet header: Message length is smaller than header.";
+    case Code::SchemaMismatch:
+        return "Can't parse packet: Message does not match schema.";
+    }
+
+    return "Unknown error.";
+}
+
+Diameter::ParseResult Diameter::ParseResult::shifted(uint32_t offset) const
+{
+    if (isOk())
+    {
+        return *this;
+    }
+
+    return ParseResult(m_code, m_offset + offset, m_avpCode);
+}
@@ -0,0 +1,44 @@
+#include <Diameter/Schema.hpp>
+
+Diameter::Schema::Octets::Octets() :
+    m_data(nullptr),
+    m_size(0)
+{
+
+}
+
+Diameter::Schema::Octets::Octets(const uint8_t* data, std::size_t size) :
+    m_data(data),
+    m_size(size)
+{
+
+}
+
+Diameter::Schema::Octets::Octets(const ByteArray& value) :
+    m_data(value.data()),
+    m_size(value.size())
+{
+
+}
+
+const uint8_t* Diameter::Schema::Octets::data() const
+{
+    return m_data;
+}
+
+std::size_t Diameter::Schema::Octets::size() const
+{
+    return m_size;
+}
+
+ByteArray Diameter::Schema::Octets::toByteArray() const
+{
+    ByteArray byteArray(m_size);
+
+    if (m_size != 0)
+    {
+        byteArray.insert(byteArray.end(), m_data, m_data + m_size);
+    }
+
+    return byteArray;
+}
@@ -0,0 +1,103 @@
+#include <Diameter/SegmentList.hpp>
+
+Diameter::SegmentList::SegmentList(uint32_t threshold) :
+    m_threshold(threshold),
+    m_scratch(),
+    m_segments(),
+    m_segmentStart(nullptr),
+    m_size(0)
+{
+
+}
+
+const std::vector<Diameter::SegmentList::Segment>& Diameter::SegmentList::segments() const
+{
+    return m_segments;
+}
+
+std::size_t Diameter::SegmentList::size() const
+{
+    return m_size;
+}
+
+std::size_t Diameter::SegmentList::copied() const
+{
+    std::size_t result = 0;
+
+    for (auto& segment : m_segments)
+    {
+        if (segment.data >= m_scratch.data() &&
+            segment.data < m_scratch.data() + m_scratch.size())
+        {
+            result += segment.size;
+        }
+    }
+
+    return result;
+}
+
+uint32_t Diameter::SegmentList::threshold() const
+{
+    return m_threshold;
+}
+
+void Diameter::SegmentList::clear()
+{
+    m_segments.clear();
+    m_segmentStart = nullptr;
+    m_size = 0;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+void Diameter::SegmentList::toIOVec(std::vector<iovec>& vectors) const
+{
+    vectors.clear();
+    vectors.reserve(m_segments.size());
+
+    for (auto& segment : m_segments)
+    {
+        iovec vector;
+        vector.iov_base = const_cast<uint8_t*>(segment.data);
+        vector.iov_len = segment.size;
+
+        vectors.push_back(vector);
+    }
+}
+#endif
+
+uint8_t* Diameter::SegmentList::prepare(std::size_t size)
+{
+    clear();
+
+    if (m_scratch.size() < size)
+    {
+        m_scratch.resize(size);
+    }
+
+    m_segmentStart = m_scratch.data();
+
+    return m_scratch.data();
+}
+
+void Diameter::SegmentList::flush(const uint8_t* cursor)
+{
+    if (cursor == m_segmentStart)
+    {
+        return;
+    }
+
+    auto size = static_cast<std::size_t>(cursor - m_segmentStart);
+
+    m_segments.push_back(Segment{m_segmentStart, size});
+    m_size += size;
+
+    m_segmentStart = cursor;
+}
+
+void Diameter::SegmentList::reference(const uint8_t* cursor, const uint8_t* data, std::size_t size)
+{
+    flush(cursor);
+
+    m_segments.push_back(Segment{data, size});
+    m_size += size;
+}
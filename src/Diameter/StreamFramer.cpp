@@ -0,0 +1,148 @@
+#include <Diameter/StreamFramer.hpp>
+#include <Diameter/Packet.hpp>
+#include <Diameter/Wire.hpp>
+#include <Diameter/Exceptions.hpp>
+#include <algorithm>
+#include <cstring>
+
+Diameter::StreamFramer::StreamFramer(uint32_t capacity) :
+    m_buffer(),
+    m_buffered(0),
+    m_chunk(nullptr),
+    m_chunkSize(0)
+{
+    if (capacity < Packet::Header::Size)
+    {
+        DIAMETER_THROW(std::invalid_argument("Capacity is smaller than packet header."));
+    }
+
+    m_buffer.resize(capacity);
+}
+
+void Diameter::StreamFramer::feed(const uint8_t* data, std::size_t size)
+{
+    if (m_chunkSize != 0)
+    {
+        DIAMETER_THROW(std::logic_error("Previous chunk is not consumed."));
+    }
+
+    m_chunk = data;
+    m_chunkSize = size;
+}
+
+Diameter::StreamFramer::Status Diameter::StreamFramer::next(const uint8_t*& message, uint32_t& size)
+{
+    if (m_buffered == 0)
+    {
+        // Fast path: message lies inside chunk
+        if (m_chunkSize >= Packet::Header::Size)
+        {
+            auto length = Wire::readUInt24(m_chunk + 1);
+
+            auto status = checkLength(length);
+
+            if (status != Status::Message)
+            {
+                return status;
+            }
+
+            if (m_chunkSize >= length)
+            {
+                message = m_chunk;
+                size = length;
+
+                m_chunk += length;
+                m_chunkSize -= length;
+
+                return Status::Message;
+            }
+        }
+
+        if (m_chunkSize == 0)
+        {
+            return Status::NeedMoreData;
+        }
+    }
+
+    // Slow path: coalescing message into buffer
+    if (m_buffered < Packet::Header::Size)
+    {
+        take(Packet::Header::Size - m_buffered);
+
+        if (m_buffered < Packet::Header::Size)
+        {
+            return Status::NeedMoreData;
+        }
+    }
+
+    auto length = Wire::readUInt24(m_buffer.data() + 1);
+
+    auto status = checkLength(length);
+
+    if (status != Status::Message)
+    {
+        return status;
+    }
+
+    take(length - m_buffered);
+
+    if (m_buffered < length)
+    {
+        return Status::NeedMoreData;
+    }
+
+    message = m_buffer.data();
+    size = length;
+
+    m_buffered = 0;
+
+    return Status::Message;
+}
+
+uint32_t Diameter::StreamFramer::buffered() const
+{
+    return m_buffered;
+}
+
+uint32_t Diameter::StreamFramer::capacity() const
+{
+    return static_cast<uint32_t>(m_buffer.size());
+}
+
+void Diameter::StreamFramer::reset()
+{
+    m_buffered = 0;
+    m_chunk = nullptr;
+    m_chunkSize = 0;
+}
+
+void Diameter::StreamFramer::take(uint32_t size)
+{
+    auto taken = static_cast<uint32_t>(std::min<std::size_t>(size, m_chunkSize));
+
+    if (taken == 0)
+    {
+        return;
+    }
+
+    std::memcpy(m_buffer.data() + m_buffered, m_chunk, taken);
+
+    m_buffered += taken;
+    m_chunk += taken;
+    m_chunkSize -= taken;
+}
+
+Diameter::StreamFramer::Status Diameter::StreamFramer::checkLength(uint32_t length) const
+{
+    if (length < Packet::Header::Size)
+    {
+        return Status::InvalidLength;
+    }
+
+    if (length > m_buffer.size())
+    {
+        return Status::TooLarge;
+    }
+
+    return Status::Message;
+}
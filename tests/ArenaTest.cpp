@@ -0,0 +1,189 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/Arena.hpp>
+#include <Diameter/Packet.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(Arena, Allocate)
+{
+    Diameter::Arena arena(64);
+
+    auto first = static_cast<uint8_t*>(arena.allocate(3, 1));
+    auto second = arena.allocate(8, 8);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8, 0);
+    ASSERT_GE(static_cast<uint8_t*>(second), first + 3);
+    ASSERT_EQ(arena.allocated(), 11);
+    ASSERT_EQ(arena.numberOfBlocks(), 1);
+
+    // Bigger than block
+    arena.allocate(100, 4);
+
+    ASSERT_EQ(arena.numberOfBlocks(), 2);
+
+    auto capacity = arena.capacity();
+
+    // Blocks are merged
+    arena.reset();
+
+    ASSERT_EQ(arena.numberOfBlocks(), 1);
+    ASSERT_EQ(arena.capacity(), capacity);
+    ASSERT_EQ(arena.allocated(), 0);
+
+    arena.allocate(8, 1);
+    arena.allocate(100, 4);
+
+    ASSERT_EQ(arena.numberOfBlocks(), 1);
+}
+
+TEST(Arena, Allocator)
+{
+    Diameter::Arena arena;
+
+    std::vector<uint32_t, Diameter::ArenaAllocator<uint32_t>> values{
+        Diameter::ArenaAllocator<uint32_t>(&arena)
+    };
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        values.push_back(i);
+    }
+
+    ASSERT_GE(arena.allocated(), 100 * sizeof(uint32_t));
+
+    // Copy does not depend on arena
+    auto copy = values;
+
+    ASSERT_EQ(copy.get_allocator().arena(), nullptr);
+
+    // Moved container keeps arena
+    auto moved = std::move(values);
+
+    ASSERT_EQ(moved.get_allocator().arena(), &arena);
+    ASSERT_EQ(copy.size(), moved.size());
+}
+
+TEST(Arena, Packet)
+{
+    Diameter::Arena arena;
+
+    ByteArray copyDeployed;
+
+    {
+        Diameter::Packet packet(arena);
+
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet, Diameter::Packet::ParseMode::Lazy).isOk());
+        ASSERT_GT(arena.allocated(), raw.size());
+        ASSERT_EQ(packet.deploy(), raw);
+        ASSERT_NE(packet.find(264), Diameter::Packet::NoAVP);
+
+        auto copy = packet;
+
+        packet.eraseAVP(0);
+
+        copyDeployed = copy.deploy();
+
+        // Packet keeps arena on reparsing
+        auto allocated = arena.allocated();
+
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet, Diameter::Packet::ParseMode::Lazy).isOk());
+        ASSERT_EQ(packet.deploy(), raw);
+        ASSERT_GE(arena.allocated(), allocated);
+    }
+
+    arena.reset();
+
+    ASSERT_EQ(copyDeployed, raw);
+}
+
+TEST(Arena, Data)
+{
+    Diameter::Arena arena;
+
+    auto big = ByteArray::fromASCII("custom.testing.server.com");
+
+    auto child = Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(296)
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .setOctetString(big)
+        )
+        .updateLength();
+
+    ByteArray expected;
+    Diameter::AVP::Data copy;
+
+    {
+        Diameter::AVP::Data data(arena);
+
+        data.setOctetString(big);
+
+        ASSERT_EQ(arena.allocated(), big.size());
+        ASSERT_EQ(data.toOctetString(), big);
+
+        // Arena buffer is reused
+        data.setUnsigned32(1);
+        data.setOctetString(big);
+
+        ASSERT_EQ(arena.allocated(), big.size());
+
+        // Added AVP and its value are kept in arena
+        data.addAVP(child);
+
+        ASSERT_GT(arena.allocated(), 2 * big.size());
+
+        expected = data.deploy();
+
+        copy = data;
+    }
+
+    // Copy does not depend on arena
+    arena.reset();
+
+    ASSERT_EQ(copy.deploy(), expected);
+}
+
+TEST(Arena, EagerPacket)
+{
+    Diameter::Arena arena;
+
+    Diameter::Packet copy;
+
+    {
+        Diameter::Packet packet(arena);
+
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet).isOk());
+
+        // Value of last AVP does not fit inline
+        ASSERT_GT(packet.avp(2).data().size(), Diameter::AVP::Data::InlineSize);
+
+        auto allocated = arena.allocated();
+
+        // AVPs and their values are reused
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet).isOk());
+        ASSERT_EQ(arena.allocated(), allocated);
+        ASSERT_EQ(packet.deploy(), raw);
+
+        copy = packet;
+    }
+
+    // Copy does not depend on arena
+    arena.reset();
+
+    ASSERT_EQ(copy.deploy(), raw);
+}
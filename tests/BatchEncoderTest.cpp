@@ -0,0 +1,85 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/BatchEncoder.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(BatchEncoder, Encode)
+{
+    std::vector<Diameter::Packet> packets(3, Diameter::Packet(raw));
+
+    packets[1].header().setHBHIdentifier(2);
+
+    ByteArray buffer = ByteArray::fromASCII("head");
+    std::vector<std::size_t> offsets;
+
+    Diameter::BatchEncoder::encode(packets, buffer, offsets);
+
+    ByteArray expected = ByteArray::fromASCII("head");
+
+    for (auto& packet : packets)
+    {
+        ASSERT_EQ(offsets[&packet - packets.data()], expected.size());
+
+        packet.deploy(expected);
+    }
+
+    ASSERT_EQ(offsets.size(), 3);
+    ASSERT_EQ(buffer, expected);
+
+    // Invalid packet in the middle
+    packets[1].header().setMessageLength(20);
+
+    ASSERT_THROW(Diameter::BatchEncoder::encode(packets, buffer, offsets), std::logic_error);
+    ASSERT_EQ(buffer, expected);
+    ASSERT_EQ(offsets.size(), 3);
+}
+
+TEST(BatchEncoder, Stamp)
+{
+    Diameter::MessageTemplate answer{Diameter::Packet(raw)};
+
+    auto host = answer.addSlot(Diameter::AVPPath().child(264));
+
+    std::vector<std::vector<Diameter::MessageTemplate::SlotValue>> values(
+        2,
+        std::vector<Diameter::MessageTemplate::SlotValue>(answer.numberOfSlots())
+    );
+
+    auto first = ByteArray::fromASCII("first.example.com");
+    auto second = ByteArray::fromASCII("second");
+
+    values[0][host] = Diameter::MessageTemplate::SlotValue(first);
+    values[1][host] = Diameter::MessageTemplate::SlotValue(second);
+
+    ByteArray buffer;
+    std::vector<std::size_t> offsets;
+
+    Diameter::BatchEncoder::stamp(answer, values, buffer, offsets);
+
+    auto expected = answer.stamp(values[0]);
+
+    ASSERT_EQ(offsets, std::vector<std::size_t>({0, expected.size()}));
+
+    answer.stamp(values[1], expected);
+
+    ASSERT_EQ(buffer, expected);
+
+    // Wrong number of values
+    values[1].clear();
+
+    ASSERT_THROW(Diameter::BatchEncoder::stamp(answer, values, buffer, offsets), std::invalid_argument);
+    ASSERT_EQ(buffer, expected);
+    ASSERT_EQ(offsets.size(), 2);
+}
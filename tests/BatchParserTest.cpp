@@ -0,0 +1,121 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/BatchParser.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(BatchParser, Split)
+{
+    ByteArray buffer;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        buffer.append(raw);
+    }
+
+    // Incomplete trailing message
+    buffer.append(raw.mid(0, 30));
+
+    std::vector<Diameter::PacketView> views;
+    std::size_t consumed = 0;
+
+    auto result = Diameter::BatchParser::split(buffer.data(), buffer.size(), views, consumed);
+
+    ASSERT_TRUE(result.isOk());
+    ASSERT_EQ(views.size(), 5);
+    ASSERT_EQ(consumed, raw.size() * 5);
+
+    for (std::size_t i = 0; i < views.size(); ++i)
+    {
+        ASSERT_EQ(views[i].data(), buffer.data() + i * raw.size());
+        ASSERT_EQ(views[i].numberOfAVPs(), 3);
+        ASSERT_TRUE(views[i].isValid());
+    }
+}
+
+TEST(BatchParser, Parse)
+{
+    ByteArray buffer;
+
+    buffer.append(raw);
+    buffer.append(raw);
+
+    std::vector<Diameter::Packet> packets;
+    std::size_t consumed = 0;
+
+    auto result = Diameter::BatchParser::parse(buffer.data(), buffer.size(), packets, consumed);
+
+    ASSERT_TRUE(result.isOk());
+    ASSERT_EQ(packets.size(), 2);
+    ASSERT_EQ(packets[1].deploy(), raw);
+
+    result = Diameter::BatchParser::parse(
+        buffer.data(),
+        buffer.size(),
+        packets,
+        consumed,
+        Diameter::Packet::ParseMode::Lazy
+    );
+
+    ASSERT_TRUE(result.isOk());
+    ASSERT_EQ(packets.size(), 4);
+    ASSERT_EQ(packets[3].deploy(), raw);
+}
+
+TEST(BatchParser, Errors)
+{
+    ByteArray buffer;
+
+    buffer.append(raw);
+    buffer.append(raw);
+    buffer.append(raw);
+
+    std::vector<Diameter::PacketView> views;
+    std::size_t consumed = 0;
+
+    auto broken = buffer;
+    broken[raw.size() * 2] = 2;
+
+    auto result = Diameter::BatchParser::split(broken.data(), broken.size(), views, consumed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::InvalidVersion);
+    ASSERT_EQ(result.offset(), raw.size() * 2);
+
+    broken = buffer;
+    broken[raw.size() + 4] |= 1;
+
+    result = Diameter::BatchParser::split(broken.data(), broken.size(), views, consumed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::InvalidFlags);
+    ASSERT_EQ(result.offset(), raw.size());
+
+    broken = buffer;
+    broken[raw.size() + 3] = 8;
+
+    result = Diameter::BatchParser::split(broken.data(), broken.size(), views, consumed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::InvalidLength);
+    ASSERT_EQ(result.offset(), raw.size());
+
+    // Broken AVP in second message
+    broken = buffer;
+    broken[raw.size() + 52 + 7] = 4;
+
+    result = Diameter::BatchParser::split(broken.data(), broken.size(), views, consumed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::AVPLengthTooSmall);
+    ASSERT_EQ(result.offset(), raw.size() + 52);
+
+    ASSERT_TRUE(views.empty());
+}
@@ -0,0 +1,149 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/CompactPacket.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+static Diameter::AVP makeAVP(uint32_t code, uint32_t vendorId, uint32_t value)
+{
+    Diameter::AVP::Header header;
+
+    header.setAVPCode(code);
+
+    if (vendorId != 0)
+    {
+        header
+            .setFlags(
+                Diameter::AVP::Header::Flags()
+                    .setFlag(Diameter::AVP::Header::Flags::Bits::VendorSpecific, true)
+            )
+            .setVendorID(vendorId);
+    }
+
+    return Diameter::AVP()
+        .setHeader(header)
+        .setData(
+            Diameter::AVP::Data()
+                .setUnsigned32(value)
+        )
+        .updateLength();
+}
+
+TEST(CompactPacket, Parsed)
+{
+    Diameter::CompactPacket packet(raw);
+
+    ASSERT_TRUE(packet.isValid());
+    ASSERT_EQ(packet.numberOfAVPs(), 3);
+    ASSERT_EQ(packet.header().commandCode(), 282);
+
+    ASSERT_EQ(packet.avpCode(0), 264);
+    ASSERT_EQ(packet.length(0), 32);
+    ASSERT_EQ(packet.vendorId(0), 0);
+    ASSERT_TRUE(packet.flags(0).isSet(Diameter::AVP::Header::Flags::Bits::Mandatory));
+
+    ASSERT_EQ(packet.find(273), 1);
+    ASSERT_EQ(packet.find(296), 2);
+    ASSERT_EQ(packet.find(263), Diameter::Packet::NoAVP);
+    ASSERT_EQ(packet.find(264, 10415), Diameter::Packet::NoAVP);
+
+    ASSERT_EQ(packet.avp(1).toUnsigned32(), 0);
+    ASSERT_EQ(packet.avp(2).toOctetString(), ByteArray::fromASCII("custom.testing.server.com"));
+    ASSERT_THROW(packet.avp(3), std::invalid_argument);
+
+    uint32_t count = 0;
+
+    for (auto avp : packet)
+    {
+        ASSERT_EQ(avp.avpCode(), packet.avpCode(count));
+        ++count;
+    }
+
+    ASSERT_EQ(count, 3);
+
+    ASSERT_EQ(packet.deploy(), raw);
+    ASSERT_EQ(packet.toPacket().deploy(), raw);
+    ASSERT_EQ(Diameter::CompactPacket(Diameter::Packet(raw)).deploy(), raw);
+}
+
+TEST(CompactPacket, Built)
+{
+    Diameter::Packet expected;
+
+    expected
+        .setHeader(
+            Diameter::Packet::Header()
+                .setCommandCode(272)
+                .setApplicationId(4)
+        )
+        .addAVP(makeAVP(415, 0, 1))
+        .addAVP(makeAVP(1032, 10415, 1004))
+        .addAVP(makeAVP(415, 0, 2))
+        .updateLength();
+
+    Diameter::CompactPacket packet;
+
+    packet
+        .setHeader(expected.header())
+        .addAVP(makeAVP(415, 0, 1))
+        .addAVP(makeAVP(1032, 10415, 1004));
+
+    // Length is not updated yet
+    ASSERT_FALSE(packet.isValid());
+
+    packet
+        .addAVP(makeAVP(415, 0, 2))
+        .updateLength();
+
+    ASSERT_TRUE(packet.isValid());
+    ASSERT_EQ(packet.calculateLength(), expected.calculateLength());
+    ASSERT_EQ(packet.deploy(), expected.deploy());
+
+    ASSERT_EQ(packet.vendorId(1), 10415);
+    ASSERT_EQ(packet.find(1032), Diameter::Packet::NoAVP);
+    ASSERT_EQ(packet.find(1032, 10415), 1);
+    ASSERT_EQ(packet.avp(1).toUnsigned32(), 1004);
+    ASSERT_EQ(packet.findAll(415), std::vector<uint32_t>({0, 2}));
+
+    // AVP length is not updated
+    auto stale = makeAVP(415, 0, 3);
+    stale.data().setUnsigned64(3);
+
+    ASSERT_THROW(packet.addAVP(stale), std::invalid_argument);
+    ASSERT_EQ(packet.numberOfAVPs(), 3);
+    ASSERT_TRUE(packet.isValid());
+
+    expected.addAVP(stale).updateLength();
+
+    ASSERT_FALSE(expected.isValid());
+    ASSERT_THROW(Diameter::CompactPacket{expected}, std::invalid_argument);
+
+    packet.clear();
+
+    ASSERT_EQ(packet.numberOfAVPs(), 0);
+    ASSERT_EQ(packet.calculateLength(), static_cast<uint32_t>(Diameter::Packet::Header::Size));
+}
+
+TEST(CompactPacket, Malformed)
+{
+    Diameter::CompactPacket packet(raw);
+
+    // Last AVP is cut
+    auto result = Diameter::CompactPacket::tryParse(raw.data(), raw.size() - 4, packet);
+
+    ASSERT_FALSE(result.isOk());
+    ASSERT_EQ(packet.deploy(), raw);
+
+    ASSERT_THROW(Diameter::CompactPacket(raw.data(), raw.size() - 4), std::invalid_argument);
+}
@@ -0,0 +1,137 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/Encoder.hpp>
+#include <Diameter/Packet.hpp>
+
+static const Diameter::AVP::Header::Flags mandatory = Diameter::AVP::Header::Flags()
+    .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true);
+
+static Diameter::AVP avp(uint32_t code,
+                         Diameter::AVP::Data data,
+                         uint32_t vendorId=0)
+{
+    auto header = Diameter::AVP::Header()
+        .setAVPCode(code)
+        .setFlags(mandatory);
+
+    if (vendorId != 0)
+    {
+        header
+            .setFlags(
+                Diameter::AVP::Header::Flags(mandatory)
+                    .setFlag(Diameter::AVP::Header::Flags::Bits::VendorSpecific, true)
+            )
+            .setVendorID(vendorId);
+    }
+
+    return Diameter::AVP()
+        .setHeader(header)
+        .setData(std::move(data))
+        .updateLength();
+}
+
+static Diameter::Packet::Header requestHeader()
+{
+    return Diameter::Packet::Header()
+        .setCommandFlags(
+            Diameter::Packet::Header::Flags()
+                .setFlag(Diameter::Packet::Header::Flags::Bits::Request, true)
+        )
+        .setCommandCode(272)
+        .setApplicationId(4)
+        .setHBHIdentifier(0x11223344)
+        .setETEIdentifier(0x55667788);
+}
+
+TEST(Encoder, Message)
+{
+    auto expected = Diameter::Packet()
+        .setHeader(requestHeader())
+        .addAVP(avp(263, Diameter::AVP::Data().setOctetString(ByteArray::fromASCII("session;1"))))
+        .addAVP(avp(415, Diameter::AVP::Data().setUnsigned32(3)))
+        .addAVP(avp(
+            456,
+            Diameter::AVP::Data()
+                .addAVP(avp(
+                    446,
+                    Diameter::AVP::Data()
+                        .addAVP(avp(421, Diameter::AVP::Data().setUnsigned64(1000)))
+                        .addAVP(avp(1, Diameter::AVP::Data().setInteger32(-5), 10415))
+                ))
+                .addAVP(avp(432, Diameter::AVP::Data().setInteger64(-1)))
+        ))
+        .addAVP(avp(296, Diameter::AVP::Data().setOctetString(ByteArray::fromASCII("realm"))))
+        .updateLength()
+        .deploy();
+
+    uint8_t buffer[256];
+
+    Diameter::Encoder encoder(buffer, sizeof(buffer));
+
+    encoder
+        .beginMessage(requestHeader())
+            .putOctetString(263, ByteArray::fromASCII("session;1"), mandatory)
+            .putUnsigned32(415, 3, mandatory)
+            .beginGrouped(456, mandatory)
+                .beginGrouped(446, mandatory)
+                    .putUnsigned64(421, 1000, mandatory)
+                    .putInteger32(1, -5, mandatory, 10415)
+                .endGrouped()
+                .putInteger64(432, -1, mandatory)
+            .endGrouped()
+            .putAVP(avp(296, Diameter::AVP::Data().setOctetString(ByteArray::fromASCII("realm"))))
+        .endMessage();
+
+    ASSERT_EQ(encoder.depth(), 0);
+    ASSERT_EQ(ByteArray(buffer, encoder.size()), expected);
+
+    // Messages follow each other
+    encoder
+        .beginMessage(requestHeader())
+        .endMessage();
+
+    ASSERT_EQ(encoder.size(), expected.size() + Diameter::Packet::Header::Size);
+
+    encoder.reset();
+
+    ASSERT_EQ(encoder.size(), 0);
+}
+
+TEST(Encoder, Errors)
+{
+    uint8_t buffer[256];
+
+    Diameter::Encoder encoder(buffer, sizeof(buffer));
+
+    ASSERT_THROW(encoder.endMessage(), std::invalid_argument);
+    ASSERT_THROW(encoder.endGrouped(), std::invalid_argument);
+
+    encoder.beginMessage(requestHeader());
+
+    ASSERT_THROW(encoder.beginMessage(requestHeader()), std::invalid_argument);
+    ASSERT_THROW(encoder.endGrouped(), std::invalid_argument);
+
+    // Buffer is left untouched
+    ASSERT_THROW(encoder.putOctetString(1, buffer, sizeof(buffer)), std::invalid_argument);
+    ASSERT_EQ(encoder.size(), static_cast<std::size_t>(Diameter::Packet::Header::Size));
+
+    encoder.beginGrouped(1);
+
+    ASSERT_THROW(encoder.endMessage(), std::invalid_argument);
+
+    encoder.endGrouped();
+    encoder.endMessage();
+
+    // Grouped AVPs without message
+    encoder.reset();
+
+    for (uint32_t i = 0; i < Diameter::Encoder::MaxDepth; ++i)
+    {
+        encoder.beginGrouped(i);
+    }
+
+    ASSERT_THROW(encoder.beginGrouped(0), std::invalid_argument);
+}
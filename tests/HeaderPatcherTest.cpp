@@ -0,0 +1,81 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/HeaderPatcher.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(HeaderPatcher, Patch)
+{
+    auto buffer = raw;
+
+    Diameter::HeaderPatcher(buffer)
+        .setHBHIdentifier(0x01020304)
+        .setETEIdentifier(0x05060708)
+        .setApplicationId(16777251)
+        .setCommandCode(316)
+        .setFlag(Diameter::Packet::Header::Flags::Bits::ReTransmitted, true)
+        .setFlag(Diameter::Packet::Header::Flags::Bits::Request, false);
+
+    Diameter::Packet packet(buffer);
+
+    ASSERT_EQ(packet.header().hbhIdentifier(), 0x01020304);
+    ASSERT_EQ(packet.header().eteIdentifier(), 0x05060708);
+    ASSERT_EQ(packet.header().applicationId(), 16777251);
+    ASSERT_EQ(packet.header().commandCode(), 316);
+    ASSERT_TRUE(packet.header().commandFlags().isSet(Diameter::Packet::Header::Flags::Bits::ReTransmitted));
+    ASSERT_FALSE(packet.header().commandFlags().isSet(Diameter::Packet::Header::Flags::Bits::Request));
+
+    // AVPs are untouched
+    ASSERT_EQ(buffer.mid(20, 80), raw.mid(20, 80));
+
+    Diameter::HeaderPatcher(buffer)
+        .setCommandFlags(
+            Diameter::Packet::Header::Flags()
+                .setFlag(Diameter::Packet::Header::Flags::Bits::Proxiable, true)
+        )
+        .setMessageLength(96);
+
+    Diameter::Packet::Header header;
+
+    ASSERT_TRUE(Diameter::Packet::Header::peek(buffer.data(), buffer.size(), header));
+    ASSERT_EQ(header.commandFlags().deploy(), 0x40);
+    ASSERT_EQ(header.messageLength(), 96);
+}
+
+TEST(HeaderPatcher, Errors)
+{
+    auto buffer = raw;
+
+    ASSERT_THROW(Diameter::HeaderPatcher(buffer.data(), 19), std::invalid_argument);
+
+    Diameter::HeaderPatcher patcher(buffer);
+
+    ASSERT_THROW(patcher.setCommandCode(1 << 24), std::invalid_argument);
+    ASSERT_THROW(patcher.setMessageLength(19), std::invalid_argument);
+    ASSERT_THROW(patcher.setMessageLength(1 << 24), std::invalid_argument);
+    ASSERT_THROW(patcher.setMessageLength(static_cast<uint32_t>(raw.size()) + 4), std::invalid_argument);
+    ASSERT_THROW(Diameter::HeaderPatcher(buffer.data(), 64).setMessageLength(100), std::invalid_argument);
+    ASSERT_THROW(patcher.setCommandFlags(Diameter::Packet::Header::Flags(0x01)), std::invalid_argument);
+
+    // Buffer is untouched on failure
+    ASSERT_EQ(buffer, raw);
+
+    patcher.setMessageLength(static_cast<uint32_t>(raw.size()));
+
+    ASSERT_EQ(buffer, raw);
+
+    buffer[0] = 2;
+
+    ASSERT_THROW(Diameter::HeaderPatcher{buffer}, std::invalid_argument);
+}
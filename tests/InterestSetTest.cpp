@@ -0,0 +1,74 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/InterestSet.hpp>
+#include <Diameter/Packet.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(InterestSet, Contains)
+{
+    Diameter::InterestSet interests;
+
+    ASSERT_TRUE(interests.empty());
+
+    interests
+        .add(283)
+        .add(293)
+        .add(263)
+        .add(282)
+        .add(263)
+        .add(1407, 10415);
+
+    ASSERT_EQ(interests.size(), 5);
+    ASSERT_TRUE(interests.contains(263));
+    ASSERT_TRUE(interests.contains(1407, 10415));
+    ASSERT_FALSE(interests.contains(1407));
+    ASSERT_FALSE(interests.contains(264));
+
+    // Same filter bit as 263
+    ASSERT_FALSE(interests.contains(263 + 64));
+}
+
+TEST(InterestSet, Parse)
+{
+    Diameter::InterestSet interests;
+
+    interests
+        .add(296)
+        .add(264, 10415);
+
+    Diameter::Packet packet(raw, interests);
+
+    // Only 296 matches, 264 has no vendor id
+    ASSERT_FALSE(packet.isMaterialized(0));
+    ASSERT_FALSE(packet.isMaterialized(1));
+    ASSERT_TRUE(packet.isMaterialized(2));
+
+    ASSERT_EQ(
+        packet.avp(2).data().toOctetString(),
+        ByteArray::fromASCII("custom.testing.server.com")
+    );
+
+    // Skipped AVPs are still accessible and forwarded untouched
+    ASSERT_EQ(packet.avp(1).data().toUnsigned32(), 0);
+    ASSERT_EQ(packet.deploy(), raw);
+
+    Diameter::Packet tried;
+
+    ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), tried, interests).isOk());
+    ASSERT_TRUE(tried.isMaterialized(2));
+    ASSERT_FALSE(Diameter::Packet::tryParse(raw.data(), 30, tried, interests).isOk());
+
+    ASSERT_THROW(Diameter::Packet(raw.mid(0, 30), interests), std::invalid_argument);
+}
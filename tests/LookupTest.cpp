@@ -0,0 +1,162 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/Packet.hpp>
+#include <future>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+static Diameter::AVP makeAVP(uint32_t code, uint32_t vendorId, uint32_t value)
+{
+    Diameter::AVP::Header header;
+
+    header.setAVPCode(code);
+
+    if (vendorId != 0)
+    {
+        header
+            .setFlags(
+                Diameter::AVP::Header::Flags()
+                    .setFlag(Diameter::AVP::Header::Flags::Bits::VendorSpecific, true)
+            )
+            .setVendorID(vendorId);
+    }
+
+    return Diameter::AVP()
+        .setHeader(header)
+        .setData(
+            Diameter::AVP::Data()
+                .setUnsigned32(value)
+        )
+        .updateLength();
+}
+
+TEST(Lookup, Parsed)
+{
+    for (auto mode : {Diameter::Packet::ParseMode::Eager, Diameter::Packet::ParseMode::Lazy})
+    {
+        Diameter::Packet packet(raw, mode);
+
+        ASSERT_EQ(packet.find(264), 0);
+        ASSERT_EQ(packet.find(273), 1);
+        ASSERT_EQ(packet.find(296), 2);
+        ASSERT_EQ(packet.find(263), Diameter::Packet::NoAVP);
+        ASSERT_EQ(packet.find(264, 10415), Diameter::Packet::NoAVP);
+
+        ASSERT_TRUE(packet.contains(296));
+        ASSERT_FALSE(packet.contains(268));
+
+        // Lookup does not decode lazy AVPs
+        ASSERT_EQ(packet.isMaterialized(2), mode == Diameter::Packet::ParseMode::Eager);
+    }
+}
+
+TEST(Lookup, Modification)
+{
+    Diameter::Packet packet;
+
+    packet
+        .addAVP(makeAVP(268, 0, 2001))
+        .addAVP(makeAVP(268, 10415, 5030))
+        .addAVP(makeAVP(443, 0, 1))
+        .addAVP(makeAVP(268, 0, 2002))
+        .addAVP(makeAVP(443, 0, 2));
+
+    ASSERT_EQ(packet.find(268), 0);
+    ASSERT_EQ(packet.find(268, 10415), 1);
+    ASSERT_EQ(packet.findAll(268), std::vector<uint32_t>({0, 3}));
+    ASSERT_EQ(packet.findAll(443), std::vector<uint32_t>({2, 4}));
+    ASSERT_TRUE(packet.findAll(444).empty());
+
+    packet.eraseAVP(0);
+
+    ASSERT_EQ(packet.find(268), 2);
+    ASSERT_EQ(packet.findAll(443), std::vector<uint32_t>({1, 3}));
+
+    packet.replaceAVP(makeAVP(263, 0, 0), 1);
+
+    ASSERT_EQ(packet.find(263), 1);
+    ASSERT_EQ(packet.findAll(443), std::vector<uint32_t>({3}));
+
+    // Changing code through mutable access
+    packet.avp(3).header().setAVPCode(264);
+
+    ASSERT_FALSE(packet.contains(443));
+    ASSERT_EQ(packet.find(264), 3);
+
+    // Changed AVPs are merged with indexed ones
+    packet.avp(1).header().setAVPCode(268);
+
+    ASSERT_EQ(packet.find(268), 1);
+    ASSERT_EQ(packet.findAll(268), std::vector<uint32_t>({1, 2}));
+
+    packet.updateLength();
+
+    ASSERT_EQ(packet.find(268), 1);
+    ASSERT_EQ(packet.findAll(268), std::vector<uint32_t>({1, 2}));
+    ASSERT_EQ(packet.find(264), 3);
+
+    // Copy keeps index
+    auto copy = packet;
+
+    ASSERT_EQ(copy.find(268, 10415), 0);
+    ASSERT_EQ(copy.find(268), 1);
+
+    // Every AVP is taken by mutable access
+    for (uint32_t i = 0; i < packet.numberOfAVPs(); ++i)
+    {
+        packet.avp(i).header().setAVPCode(300 + i % 2);
+    }
+
+    ASSERT_FALSE(packet.contains(268));
+    ASSERT_EQ(packet.find(300, 10415), 0);
+    ASSERT_EQ(packet.findAll(300), std::vector<uint32_t>({2}));
+
+    packet.updateLength();
+
+    ASSERT_EQ(packet.find(268), Diameter::Packet::NoAVP);
+    ASSERT_EQ(packet.find(301), 1);
+    ASSERT_EQ(packet.find(300, 10415), 0);
+    ASSERT_EQ(packet.findAll(300), std::vector<uint32_t>({2}));
+    ASSERT_EQ(packet.findAll(301), std::vector<uint32_t>({1, 3}));
+}
+
+TEST(Lookup, ConcurrentConst)
+{
+    Diameter::Packet packet(raw);
+
+    // AVP is exposed before packet is shared
+    packet.avp(1);
+
+    const Diameter::Packet& shared = packet;
+
+    auto lookup = [&shared]()
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            if (shared.find(296) != 2 ||
+                shared.find(273) != 1 ||
+                !shared.contains(264))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    auto other = std::async(std::launch::async, lookup);
+
+    ASSERT_TRUE(lookup());
+    ASSERT_TRUE(other.get());
+}
@@ -0,0 +1,249 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/MessageEditor.hpp>
+#include <Diameter/Packet.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+static Diameter::AVP routeRecord(const char* host)
+{
+    return Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(282)
+                .setFlags(
+                    Diameter::AVP::Header::Flags()
+                        .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true)
+                )
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .setOctetString(ByteArray::fromASCII(host))
+        )
+        .updateLength();
+}
+
+TEST(MessageEditor, InsertRemove)
+{
+    auto message = raw;
+
+    Diameter::MessageEditor editor(message);
+
+    ASSERT_EQ(editor.numberOfAVPs(), 3);
+    ASSERT_EQ(editor.find(273), 1);
+    ASSERT_EQ(editor.find(282), Diameter::MessageEditor::NoAVP);
+
+    editor
+        .appendAVP(routeRecord("relay.example.com"))
+        .insertAVP(1, routeRecord("a.b"))
+        .removeAVP(2);
+
+    // Same as editing decoded packet
+    auto expected = Diameter::Packet(raw)
+        .addAVP(routeRecord("relay.example.com"))
+        .replaceAVP(routeRecord("a.b"), 1)
+        .updateLength()
+        .deploy();
+
+    ASSERT_EQ(message, expected);
+    ASSERT_TRUE(Diameter::Packet(message).isValid());
+
+    ASSERT_EQ(editor.numberOfAVPs(), 4);
+    ASSERT_EQ(editor.avp(3).toOctetString(), ByteArray::fromASCII("relay.example.com"));
+
+    // Copying serialized AVP from another message
+    auto other = raw;
+
+    Diameter::MessageEditor(other)
+        .appendAVP(editor.avp(1));
+
+    ASSERT_EQ(Diameter::Packet(other).avp(3).data().toOctetString(), ByteArray::fromASCII("a.b"));
+}
+
+TEST(MessageEditor, RemoveAll)
+{
+    auto message = raw;
+
+    Diameter::MessageEditor editor(message);
+
+    editor
+        .insertAVP(0, routeRecord("first"))
+        .insertAVP(2, routeRecord("second"))
+        .appendAVP(routeRecord("third"));
+
+    ASSERT_EQ(editor.removeAll(282), 3);
+    ASSERT_EQ(editor.removeAll(282), 0);
+    ASSERT_EQ(message, raw);
+    ASSERT_EQ(editor.avp(2).avpCode(), 296);
+
+    // Vendor specific AVP does not match
+    ASSERT_EQ(editor.removeAll(264, 10415), 0);
+    ASSERT_EQ(editor.removeAll(264), 1);
+    ASSERT_EQ(message.size(), 68);
+    ASSERT_EQ(Diameter::Packet(message).header().messageLength(), 68);
+}
+
+TEST(MessageEditor, Errors)
+{
+    auto message = raw.mid(0, 90);
+
+    ASSERT_THROW(Diameter::MessageEditor{message}, std::invalid_argument);
+
+    message = raw;
+
+    Diameter::MessageEditor editor(message);
+
+    ASSERT_THROW(editor.insertAVP(4, routeRecord("a")), std::invalid_argument);
+    ASSERT_THROW(editor.removeAVP(3), std::invalid_argument);
+    ASSERT_THROW(editor.avp(3), std::invalid_argument);
+
+    // AVP length is not updated
+    auto stale = routeRecord("a");
+    stale.data().setOctetString(ByteArray::fromASCII("relay.example.com"));
+
+    ASSERT_THROW(editor.appendAVP(stale), std::invalid_argument);
+    ASSERT_EQ(message, raw);
+}
+
+TEST(MessageEditor, InsertOwnAVP)
+{
+    auto message = raw;
+
+    Diameter::MessageEditor editor(message);
+
+    // View points into edited message
+    editor
+        .appendAVP(editor.avp(0))
+        .insertAVP(0, editor.avp(2));
+
+    const Diameter::Packet packet(raw);
+
+    auto expected = Diameter::Packet()
+        .setHeader(packet.header())
+        .addAVP(packet.avp(2))
+        .addAVP(packet.avp(0))
+        .addAVP(packet.avp(1))
+        .addAVP(packet.avp(2))
+        .addAVP(packet.avp(0))
+        .updateLength()
+        .deploy();
+
+    ASSERT_EQ(message, expected);
+    ASSERT_TRUE(Diameter::Packet(message).isValid());
+}
+
+static Diameter::AVP grouped(uint32_t code, uint32_t vendorId, const std::vector<Diameter::AVP>& children)
+{
+    Diameter::AVP::Header header;
+
+    header.setAVPCode(code);
+
+    if (vendorId != 0)
+    {
+        header
+            .setFlags(
+                Diameter::AVP::Header::Flags()
+                    .setFlag(Diameter::AVP::Header::Flags::Bits::VendorSpecific, true)
+            )
+            .setVendorID(vendorId);
+    }
+
+    return Diameter::AVP()
+        .setHeader(header)
+        .setData(
+            Diameter::AVP::Data()
+                .addAVP(children.begin(), children.end())
+        )
+        .updateLength();
+}
+
+static Diameter::AVP leaf(uint32_t code, uint32_t vendorId, const char* value)
+{
+    return grouped(code, vendorId, {})
+        .setData(Diameter::AVP::Data().setOctetString(ByteArray::fromASCII(value)))
+        .updateLength();
+}
+
+static Diameter::Packet subscriber(const char* subscriptionIdData, const char* chargingId)
+{
+    return Diameter::Packet()
+        .addAVP(leaf(263, 0, "session;1"))
+        .addAVP(
+            grouped(443, 0, {
+                leaf(450, 0, "type"),
+                leaf(444, 0, subscriptionIdData)
+            })
+        )
+        .addAVP(
+            grouped(873, 10415, {
+                grouped(874, 10415, {
+                    leaf(2, 10415, chargingId)
+                })
+            })
+        )
+        .addAVP(leaf(296, 0, "realm"))
+        .updateLength();
+}
+
+TEST(MessageEditor, SetValue)
+{
+    auto message = subscriber("123", "abcd").deploy();
+
+    Diameter::MessageEditor editor(message);
+
+    auto subscriptionIdData = Diameter::AVPPath()
+        .child(443)
+        .child(444);
+
+    auto chargingId = Diameter::AVPPath()
+        .child(873, 10415)
+        .child(874, 10415)
+        .child(2, 10415);
+
+    ASSERT_TRUE(editor.contains(subscriptionIdData));
+    ASSERT_FALSE(editor.contains(Diameter::AVPPath().child(443).child(444, 0, 1)));
+    ASSERT_FALSE(editor.contains(Diameter::AVPPath().child(873).child(874)));
+    ASSERT_EQ(editor.avp(chargingId).toOctetString(), ByteArray::fromASCII("abcd"));
+
+    // Growing, shrinking and keeping padded size
+    editor
+        .setValue(subscriptionIdData, ByteArray::fromASCII("79161234567"))
+        .setValue(chargingId, ByteArray::fromASCII("a"));
+
+    ASSERT_EQ(message, subscriber("79161234567", "a").deploy());
+
+    editor.setValue(chargingId, ByteArray::fromASCII("bc"));
+
+    ASSERT_EQ(message, subscriber("79161234567", "bc").deploy());
+
+    // Top-level offsets follow edits
+    ASSERT_EQ(editor.avp(3).toOctetString(), ByteArray::fromASCII("realm"));
+    ASSERT_TRUE(Diameter::Packet(message).isValid());
+
+    // Value is taken from edited message
+    auto realm = editor.avp(3);
+
+    editor.setValue(subscriptionIdData, realm.data(), realm.dataSize());
+
+    ASSERT_EQ(message, subscriber("realm", "bc").deploy());
+
+    auto sessionId = editor.avp(0);
+
+    editor.setValue(chargingId, sessionId.data(), sessionId.dataSize());
+
+    ASSERT_EQ(message, subscriber("realm", "session;1").deploy());
+
+    ASSERT_THROW(editor.setValue(Diameter::AVPPath().child(1), ByteArray()), std::invalid_argument);
+    ASSERT_THROW(editor.avp(Diameter::AVPPath()), std::invalid_argument);
+}
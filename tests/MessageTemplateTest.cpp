@@ -0,0 +1,139 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/MessageTemplate.hpp>
+#include <Diameter/Packet.hpp>
+#include <type_traits>
+
+static Diameter::AVP octetString(uint32_t code, const ByteArray& value)
+{
+    return Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(code)
+                .setFlags(
+                    Diameter::AVP::Header::Flags()
+                        .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true)
+                )
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .setOctetString(value)
+        )
+        .updateLength();
+}
+
+static Diameter::AVP unsigned32(uint32_t code, uint32_t value)
+{
+    return octetString(code, ByteArray())
+        .setData(
+            Diameter::AVP::Data()
+                .setUnsigned32(value)
+        )
+        .updateLength();
+}
+
+// CCR-U with Session-Id, CC-Request-Number and
+// Used-Service-Unit -> CC-Total-Octets, CC-Service-Specific-Units
+static Diameter::Packet creditControl(const char* sessionId,
+                                      uint32_t requestNumber,
+                                      const char* totalOctets)
+{
+    return Diameter::Packet()
+        .setHeader(
+            Diameter::Packet::Header()
+                .setCommandFlags(
+                    Diameter::Packet::Header::Flags()
+                        .setFlag(Diameter::Packet::Header::Flags::Bits::Request, true)
+                )
+                .setCommandCode(272)
+                .setApplicationId(4)
+        )
+        .addAVP(octetString(263, ByteArray::fromASCII(sessionId)))
+        .addAVP(unsigned32(416, 2))
+        .addAVP(unsigned32(415, requestNumber))
+        .addAVP(
+            octetString(446, ByteArray())
+                .setData(
+                    Diameter::AVP::Data()
+                        .addAVP(octetString(421, ByteArray::fromASCII(totalOctets)))
+                        .addAVP(unsigned32(417, 7))
+                )
+                .updateLength()
+        )
+        .addAVP(octetString(296, ByteArray::fromASCII("realm")))
+        .updateLength();
+}
+
+TEST(MessageTemplate, Stamp)
+{
+    Diameter::MessageTemplate ccr(creditControl("session;0", 0, "0"));
+
+    auto totalOctets = ccr.addSlot(Diameter::AVPPath().child(446).child(421));
+    auto sessionId = ccr.addSlot(Diameter::AVPPath().child(263));
+    auto requestNumber = ccr.addSlot(Diameter::AVPPath().child(415));
+
+    ASSERT_EQ(ccr.numberOfSlots(), 3);
+    ASSERT_EQ(ccr.prototype(), creditControl("session;0", 0, "0").deploy());
+
+    // Temporary byte array can't be referenced
+    static_assert(!std::is_convertible<ByteArray, Diameter::MessageTemplate::SlotValue>::value, "");
+    static_assert(!std::is_constructible<Diameter::MessageTemplate::SlotValue, ByteArray&&>::value, "");
+
+    std::vector<Diameter::MessageTemplate::SlotValue> values(ccr.numberOfSlots());
+
+    auto session = ByteArray::fromASCII("host.example.com;1;25");
+    auto octets = ByteArray::fromASCII("123456");
+
+    values[sessionId] = Diameter::MessageTemplate::SlotValue(session);
+    values[requestNumber] = Diameter::MessageTemplate::SlotValue::fromUnsigned32(12);
+    values[totalOctets] = Diameter::MessageTemplate::SlotValue(octets);
+
+    auto expected = creditControl("host.example.com;1;25", 12, "123456").deploy();
+
+    ASSERT_EQ(ccr.calculateLength(values), expected.size());
+    ASSERT_EQ(ccr.stamp(values), expected);
+
+    // Shrinking and appending
+    auto shorter = ByteArray::fromASCII("s");
+
+    values[sessionId] = Diameter::MessageTemplate::SlotValue(shorter);
+    values[totalOctets] = Diameter::MessageTemplate::SlotValue();
+
+    ByteArray message = expected;
+
+    ccr.stamp(values, message);
+
+    expected.append(creditControl("s", 12, "").deploy());
+
+    ASSERT_EQ(message, expected);
+
+    // Raw memory
+    ByteArray raw;
+    raw.resize(ccr.calculateLength(values));
+
+    ASSERT_EQ(ccr.stamp(values, raw.data()), raw.data() + raw.size());
+    ASSERT_EQ(raw, creditControl("s", 12, "").deploy());
+}
+
+TEST(MessageTemplate, Errors)
+{
+    Diameter::MessageTemplate ccr(creditControl("session;0", 0, "0"));
+
+    ASSERT_THROW(ccr.addSlot(Diameter::AVPPath().child(1)), std::invalid_argument);
+
+    ccr.addSlot(Diameter::AVPPath().child(446).child(421));
+
+    // Slot inside of slot
+    ASSERT_THROW(ccr.addSlot(Diameter::AVPPath().child(446)), std::invalid_argument);
+
+    ASSERT_THROW(ccr.stamp({}), std::invalid_argument);
+    ASSERT_EQ(ccr.numberOfSlots(), 1);
+    // Header length is not updated
+    auto stale = creditControl("session;0", 0, "0")
+        .addAVP(unsigned32(416, 3));
+
+    ASSERT_THROW(Diameter::MessageTemplate{stale}, std::invalid_argument);
+}
@@ -0,0 +1,106 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/PacketPool.hpp>
+#include <thread>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(PacketPool, Reparse)
+{
+    auto modified = Diameter::Packet(raw);
+
+    modified.avp(2).data().setOctetString(ByteArray::fromASCII("realm"));
+    modified.avp(2).updateLength();
+    modified.updateLength();
+
+    auto shorter = modified.deploy();
+
+    for (auto mode : {Diameter::Packet::ParseMode::Eager,
+                      Diameter::Packet::ParseMode::Lazy,
+                      Diameter::Packet::ParseMode::Memoized})
+    {
+        Diameter::Packet packet;
+
+        // Previous AVPs are overwritten
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet, mode).isOk());
+        ASSERT_TRUE(Diameter::Packet::tryParse(shorter.data(), shorter.size(), packet, mode).isOk());
+        ASSERT_EQ(packet.deploy(), shorter);
+        ASSERT_EQ(packet.avp(2).data().toOctetString(), ByteArray::fromASCII("realm"));
+
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet, mode).isOk());
+        ASSERT_EQ(packet.deploy(), raw);
+        ASSERT_EQ(packet.find(264), 0);
+
+        packet.reset();
+
+        ASSERT_EQ(packet.numberOfAVPs(), 0);
+        ASSERT_EQ(packet.calculateLength(), static_cast<uint32_t>(Diameter::Packet::Header::Size));
+        ASSERT_EQ(packet.find(264), Diameter::Packet::NoAVP);
+        ASSERT_EQ(packet.deploy(false), Diameter::Packet().deploy(false));
+    }
+}
+
+TEST(PacketPool, AcquireRelease)
+{
+    Diameter::PacketPool pool(2);
+
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+    auto third = pool.acquire();
+
+    ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), first).isOk());
+
+    pool.release(std::move(first));
+    pool.release(std::move(second));
+    pool.release(std::move(third));
+
+    ASSERT_EQ(pool.size(), 2);
+
+    // Packets are given back empty
+    auto packet = pool.acquire();
+
+    ASSERT_EQ(packet.numberOfAVPs(), 0);
+    ASSERT_EQ(pool.size(), 1);
+
+    // Arena backed packets are not kept
+    Diameter::Arena arena;
+
+    pool.release(Diameter::Packet(arena));
+
+    ASSERT_EQ(pool.size(), 1);
+
+    pool.clear();
+
+    ASSERT_EQ(pool.size(), 0);
+}
+
+TEST(PacketPool, Local)
+{
+    auto pool = &Diameter::PacketPool::local();
+
+    ASSERT_EQ(pool, &Diameter::PacketPool::local());
+
+    Diameter::PacketPool* other = nullptr;
+
+    std::thread thread(
+        [&other]()
+        {
+            other = &Diameter::PacketPool::local();
+        }
+    );
+
+    thread.join();
+
+    ASSERT_NE(pool, other);
+}
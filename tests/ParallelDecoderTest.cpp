@@ -0,0 +1,73 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/ParallelDecoder.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(ParallelDecoder, Decode)
+{
+    std::vector<ByteArray> messages;
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        // Unique Hop-By-Hop identifier to check order
+        auto message = raw.mid(0, 12);
+        message.append<uint32_t>(i);
+        message.append(raw.mid(16, raw.size() - 16));
+
+        messages.push_back(message);
+    }
+
+    // Broken message
+    messages[500] = raw.mid(0, 30);
+
+    Diameter::ParallelDecoder decoder(4);
+
+    ASSERT_EQ(decoder.numberOfThreads(), 4);
+
+    std::vector<Diameter::Packet> packets;
+    std::vector<Diameter::ParseResult> results;
+
+    // Reusing pool for several batches
+    for (int batch = 0; batch < 3; ++batch)
+    {
+        decoder.decode(messages, packets, results);
+
+        ASSERT_EQ(packets.size(), messages.size());
+        ASSERT_EQ(results.size(), messages.size());
+
+        for (uint32_t i = 0; i < messages.size(); ++i)
+        {
+            if (i == 500)
+            {
+                ASSERT_FALSE(results[i].isOk());
+                continue;
+            }
+
+            ASSERT_TRUE(results[i].isOk());
+            ASSERT_EQ(packets[i].header().hbhIdentifier(), i);
+            ASSERT_EQ(packets[i].numberOfAVPs(), 3);
+        }
+    }
+
+    decoder.decode(std::vector<ByteArray>(), packets, results);
+
+    ASSERT_TRUE(packets.empty());
+    ASSERT_TRUE(results.empty());
+}
+
+TEST(ParallelDecoder, Errors)
+{
+    ASSERT_THROW(Diameter::ParallelDecoder(0), std::invalid_argument);
+}
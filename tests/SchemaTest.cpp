@@ -0,0 +1,176 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <Diameter/Schema.hpp>
+#include <Diameter/Packet.hpp>
+
+namespace
+{
+    const Diameter::Packet::Header::Flags::Type Request =
+        static_cast<Diameter::Packet::Header::Flags::Type>(Diameter::Packet::Header::Flags::Bits::Request);
+
+    // Device-Watchdog-Request
+    using DWR = Diameter::Schema::Message<
+        280,
+        Request,
+        0,
+        Diameter::Schema::Field<264, Diameter::Schema::Type::OctetString>, // Origin-Host
+        Diameter::Schema::Field<296, Diameter::Schema::Type::OctetString>, // Origin-Realm
+        Diameter::Schema::Field<278, Diameter::Schema::Type::Unsigned32>   // Origin-State-Id
+    >;
+
+    // Answer with fixed size AVPs only
+    using Fixed = Diameter::Schema::Message<
+        272,
+        0,
+        4,
+        Diameter::Schema::Field<268, Diameter::Schema::Type::Unsigned32>,        // Result-Code
+        Diameter::Schema::Field<415, Diameter::Schema::Type::Unsigned32>,        // CC-Request-Number
+        Diameter::Schema::Field<2, Diameter::Schema::Type::Unsigned64, 0, 10415> // Vendor specific
+    >;
+
+    static_assert(!DWR::isFixed(), "DWR has octet strings.");
+    static_assert(DWR::minimumLength() == 20 + 8 + 8 + 12, "Invalid DWR minimum length.");
+    static_assert(Fixed::isFixed(), "Fixed has fixed size AVPs only.");
+    static_assert(Fixed::minimumLength() == 20 + 12 + 12 + 20, "Invalid fixed length.");
+
+    Diameter::AVP avp(uint32_t code, const Diameter::AVP::Data& data)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+                    .setFlags(
+                        Diameter::AVP::Header::Flags()
+                            .setFlag(Diameter::AVP::Header::Flags::Bits::Mandatory, true)
+                    )
+            )
+            .setData(data)
+            .updateLength();
+    }
+
+    Diameter::Packet watchdog(const char* host, const char* realm, uint32_t stateId)
+    {
+        return Diameter::Packet()
+            .setHeader(
+                Diameter::Packet::Header()
+                    .setCommandFlags(Diameter::Packet::Header::Flags(Request))
+                    .setCommandCode(280)
+                    .setHBHIdentifier(0x11223344)
+                    .setETEIdentifier(0x55667788)
+            )
+            .addAVP(avp(264, Diameter::AVP::Data().setOctetString(ByteArray::fromASCII(host))))
+            .addAVP(avp(296, Diameter::AVP::Data().setOctetString(ByteArray::fromASCII(realm))))
+            .addAVP(avp(278, Diameter::AVP::Data().setUnsigned32(stateId)))
+            .updateLength();
+    }
+}
+
+TEST(Schema, Encode)
+{
+    auto host = ByteArray::fromASCII("client.example.com");
+    auto realm = ByteArray::fromASCII("example.org");
+
+    // Temporary byte array can't be referenced
+    static_assert(!std::is_convertible<ByteArray, Diameter::Schema::Octets>::value, "");
+    static_assert(!std::is_constructible<Diameter::Schema::Octets, ByteArray&&>::value, "");
+
+    DWR::Values values(host, realm, 7u);
+
+    ByteArray message;
+
+    DWR::encode(values, 0x11223344, 0x55667788, message);
+
+    ASSERT_EQ(DWR::calculateLength(values), message.size());
+    ASSERT_EQ(message, watchdog("client.example.com", "example.org", 7).deploy());
+}
+
+TEST(Schema, Decode)
+{
+    auto message = watchdog("client.example.com", "example.org", 7).deploy();
+
+    DWR::Values values;
+
+    ASSERT_TRUE(DWR::decode(message.data(), message.size(), values).isOk());
+    ASSERT_EQ(std::get<0>(values).toByteArray(), ByteArray::fromASCII("client.example.com"));
+    ASSERT_EQ(std::get<1>(values).toByteArray(), ByteArray::fromASCII("example.org"));
+    ASSERT_EQ(std::get<2>(values), 7);
+
+    // Truncated message
+    auto result = DWR::decode(message.data(), message.size() - 4, values);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::AVPLengthTooLarge);
+    ASSERT_EQ(result.avpCode(), 278);
+
+    // AVP out of schema order
+    auto reordered = Diameter::Packet(message);
+
+    reordered.replaceAVP(avp(295, Diameter::AVP::Data().setUnsigned32(7)), 2);
+
+    auto binary = reordered.deploy();
+
+    result = DWR::decode(binary.data(), binary.size(), values);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::SchemaMismatch);
+    ASSERT_EQ(result.offset(), message.size() - 12);
+
+    // Header length does not match buffer
+    auto patched = message;
+
+    patched[3] += 4;
+
+    result = DWR::decode(patched.data(), patched.size(), values);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::SchemaMismatch);
+    ASSERT_EQ(result.offset(), 1);
+
+    // Other command
+    Fixed::Values fixed;
+
+    result = Fixed::decode(message.data(), message.size(), fixed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::SchemaMismatch);
+}
+
+TEST(Schema, Fixed)
+{
+    Fixed::Values values(2001u, 3u, 0x0102030405060708ull);
+
+    ByteArray message;
+    message.resize(Fixed::minimumLength());
+
+    ASSERT_EQ(Fixed::encode(values, 1, 2, message.data()), message.data() + message.size());
+
+    Fixed::Values decoded;
+
+    ASSERT_TRUE(Fixed::decode(message.data(), message.size(), decoded).isOk());
+    ASSERT_EQ(decoded, values);
+
+    Diameter::Packet packet(message);
+
+    ASSERT_TRUE(packet.isValid());
+    ASSERT_EQ(packet.avp(2).header().vendorId(), 10415);
+    ASSERT_EQ(packet.avp(2).data().toUnsigned64(), 0x0102030405060708ull);
+
+    // Extra AVP
+    message.append(message.mid(20, 12));
+
+    ASSERT_EQ(
+        Fixed::decode(message.data(), message.size(), decoded).code(),
+        Diameter::ParseResult::Code::SchemaMismatch
+    );
+}
+
+TEST(Schema, LiteralFlags)
+{
+    constexpr Diameter::AVP::Header::Flags flags(0x40);
+
+    static_assert(flags.isSet(Diameter::AVP::Header::Flags::Bits::Mandatory), "Mandatory bit is not set.");
+    static_assert(flags.isValid(), "Flags are invalid.");
+    static_assert(!Diameter::Packet::Header::Flags(0x01).isValid(), "Reserved bit is accepted.");
+
+    ASSERT_EQ(flags.deploy(), 0x40);
+}
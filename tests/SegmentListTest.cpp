@@ -0,0 +1,105 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/SegmentList.hpp>
+#include <Diameter/Packet.hpp>
+
+static Diameter::AVP makeAVP(uint32_t code, uint32_t size)
+{
+    ByteArray value;
+
+    value.appendMultiple<uint8_t>(static_cast<uint8_t>(code), size);
+
+    return Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(code)
+        )
+        .setData(Diameter::AVP::Data(value))
+        .updateLength();
+}
+
+static ByteArray join(const Diameter::SegmentList& segments)
+{
+    ByteArray result;
+
+    for (auto& segment : segments.segments())
+    {
+        result.append(ByteArray(segment.data, segment.size));
+    }
+
+    return result;
+}
+
+TEST(SegmentList, Deploy)
+{
+    Diameter::Packet packet;
+
+    packet
+        .addAVP(makeAVP(263, 10))
+        .addAVP(makeAVP(462, 4097))
+        .addAVP(makeAVP(264, 5))
+        .addAVP(makeAVP(462, 1001))
+        .updateLength();
+
+    Diameter::SegmentList segments(512);
+
+    packet.deploy(segments);
+
+    auto expected = packet.deploy();
+
+    ASSERT_EQ(segments.size(), expected.size());
+    ASSERT_EQ(join(segments), expected);
+
+    // Scratch, value, scratch, value, padding
+    ASSERT_EQ(segments.segments().size(), 5);
+    ASSERT_EQ(segments.segments()[1].data, packet.avp(1).data().data());
+    ASSERT_EQ(segments.copied(), expected.size() - 4097 - 1001);
+
+#if defined(__unix__) || defined(__APPLE__)
+    std::vector<iovec> vectors;
+
+    segments.toIOVec(vectors);
+
+    ASSERT_EQ(vectors.size(), 5);
+    ASSERT_EQ(vectors[3].iov_len, 1001);
+#endif
+
+    // Everything is copied with large threshold
+    Diameter::SegmentList copied(1 << 20);
+
+    packet.deploy(copied);
+
+    ASSERT_EQ(copied.segments().size(), 1);
+    ASSERT_EQ(join(copied), expected);
+}
+
+TEST(SegmentList, DeployLazy)
+{
+    Diameter::Packet source;
+
+    source
+        .addAVP(makeAVP(263, 10))
+        .addAVP(makeAVP(462, 2000))
+        .updateLength();
+
+    auto binary = source.deploy();
+
+    Diameter::Packet packet(binary, Diameter::Packet::ParseMode::Lazy);
+
+    Diameter::SegmentList segments;
+
+    packet.deploy(segments);
+
+    // Raw AVP is referenced as a whole
+    ASSERT_EQ(segments.segments().size(), 2);
+    ASSERT_EQ(segments.segments()[1].size, 2008);
+    ASSERT_EQ(join(segments), binary);
+
+    // Reusing list
+    packet.deploy(segments);
+
+    ASSERT_EQ(join(segments), binary);
+}
@@ -1,6 +1,7 @@
 
 #include <gtest/gtest.h>
 #include <Diameter/Packet.hpp>
+#include <Diameter/BatchEncoder.hpp>
 
 static const ByteArray raw = ByteArray::fromHex(
         "010000648000011a000000007ddf9367"
@@ -191,4 +192,460 @@ TEST(Serialization, FromBinary)
         ByteArray::fromASCII("custom.testing.server.com")
     );
 
-}
\ No newline at end of file
+}
+
+TEST(Serialization, FromBinaryLazy)
+{
+    Diameter::Packet parsed;
+
+    ASSERT_NO_THROW(parsed = Diameter::Packet(raw, Diameter::Packet::ParseMode::Lazy));
+
+    ASSERT_EQ(parsed.numberOfAVPs(), 3);
+
+    ASSERT_FALSE(parsed.isMaterialized(0));
+    ASSERT_FALSE(parsed.isMaterialized(1));
+    ASSERT_FALSE(parsed.isMaterialized(2));
+    ASSERT_THROW(parsed.isMaterialized(3), std::invalid_argument);
+
+    ASSERT_TRUE(parsed.isValid());
+    ASSERT_EQ(parsed.deploy(), raw);
+
+    ASSERT_EQ(parsed.avp(1).data().toUnsigned32(), 0);
+
+    ASSERT_TRUE(parsed.isMaterialized(1));
+    ASSERT_FALSE(parsed.isMaterialized(0));
+
+    ASSERT_EQ(
+        static_cast<const Diameter::Packet&>(parsed).avp(2).data().toOctetString(),
+        ByteArray::fromASCII("custom.testing.server.com")
+    );
+
+    ASSERT_FALSE(parsed.isMaterialized(2));
+
+    parsed.avp(1).data().setUnsigned32(1);
+    parsed.eraseAVP(0);
+
+    ASSERT_EQ(parsed.numberOfAVPs(), 2);
+    ASSERT_EQ(parsed.avp(0).data().toUnsigned32(), 1);
+    ASSERT_FALSE(parsed.isMaterialized(1));
+
+    Diameter::Packet eager(raw);
+
+    eager.avp(1).data().setUnsigned32(1);
+    eager.eraseAVP(0);
+
+    ASSERT_EQ(parsed.deploy(false), eager.deploy(false));
+}
+
+TEST(Serialization, FromBinaryMemoized)
+{
+    // Non-zero padding of Origin-Realm survives round-trip
+    auto binary = raw;
+    binary[99] = 0xEE;
+
+    Diameter::Packet packet(binary, Diameter::Packet::ParseMode::Memoized);
+
+    for (uint32_t i = 0; i < packet.numberOfAVPs(); ++i)
+    {
+        ASSERT_TRUE(static_cast<const Diameter::Packet&>(packet).avp(i).isMemoized());
+    }
+
+    ASSERT_EQ(packet.deploy(), binary);
+
+    // Only modified AVP is encoded again
+    packet.avp(1).data().setUnsigned32(1);
+
+    ASSERT_FALSE(packet.avp(1).isMemoized());
+    ASSERT_TRUE(static_cast<const Diameter::Packet&>(packet).avp(0).isMemoized());
+
+    auto expected = binary;
+    expected[63] = 1;
+
+    ASSERT_EQ(packet.deploy(), expected);
+
+    // Memoizing manually built AVP
+    auto avp = packet.avp(1);
+
+    avp.memoize();
+
+    ASSERT_TRUE(avp.isMemoized());
+    ASSERT_EQ(avp.deploy(), expected.mid(52, 12));
+
+    avp.updateLength();
+
+    ASSERT_TRUE(avp.isMemoized());
+
+    avp.setData(Diameter::AVP::Data().setUnsigned64(1)).updateLength();
+
+    ASSERT_FALSE(avp.isMemoized());
+    ASSERT_EQ(avp.deploy().size(), 16);
+}
+
+TEST(Serialization, TryParse)
+{
+    Diameter::Packet parsed;
+
+    auto result = Diameter::Packet::tryParse(raw.data(), raw.size(), parsed);
+
+    ASSERT_TRUE(result.isOk());
+    ASSERT_EQ(parsed.numberOfAVPs(), 3);
+    ASSERT_EQ(parsed.deploy(), raw);
+
+    result = Diameter::Packet::tryParse(raw.data(), 10, parsed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::HeaderTooSmall);
+
+    // Previous packet is untouched on failure
+    ASSERT_EQ(parsed.numberOfAVPs(), 3);
+
+    // Origin-Realm does not fit
+    result = Diameter::Packet::tryParse(raw.data(), raw.size() - 4, parsed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::AVPLengthTooLarge);
+    ASSERT_EQ(result.offset(), 64);
+    ASSERT_EQ(result.avpCode(), 296);
+
+    // Disconnect-Cause length is smaller than header
+    auto broken = raw;
+    broken[52 + 7] = 7;
+
+    result = Diameter::Packet::tryParse(broken.data(), broken.size(), parsed);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::AVPLengthTooSmall);
+    ASSERT_EQ(result.offset(), 52);
+    ASSERT_EQ(result.avpCode(), 273);
+
+    ASSERT_ANY_THROW(Diameter::Packet{broken});
+}
+
+TEST(Serialization, ToRawMemory)
+{
+    Diameter::Packet packet(raw);
+
+    // Canary after packet
+    std::vector<uint8_t> buffer(raw.size() + 1, 0xAA);
+
+    auto end = packet.deploy(buffer.data());
+
+    ASSERT_EQ(end, buffer.data() + raw.size());
+    ASSERT_EQ(buffer.back(), 0xAA);
+    ASSERT_TRUE(std::equal(raw.begin(), raw.end(), buffer.begin()));
+
+    // Appending to existing data
+    ByteArray appended = ByteArray::fromHex("0102");
+
+    packet.deploy(appended);
+
+    ASSERT_EQ(appended.size(), raw.size() + 2);
+    ASSERT_EQ(appended.mid(2, raw.size()), raw);
+}
+
+TEST(Serialization, CachedLength)
+{
+    Diameter::Packet packet(raw, Diameter::Packet::ParseMode::Lazy);
+
+    ASSERT_EQ(packet.calculateLength(), raw.size());
+
+    auto avp = Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(282)
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .setOctetString(ByteArray::fromASCII("relay"))
+        )
+        .updateLength();
+
+    packet.addAVP(avp);
+
+    ASSERT_EQ(packet.calculateLength(), raw.size() + 16);
+
+    packet.replaceAVP(avp, 0);
+
+    ASSERT_EQ(packet.calculateLength(), raw.size() + 16 - 32 + 16);
+
+    packet.eraseAVP(0);
+
+    ASSERT_EQ(packet.calculateLength(), raw.size() - 32 + 16);
+
+    // Mutable access is recalculated
+    packet.avp(0).setData(Diameter::AVP::Data().setUnsigned64(1));
+
+    ASSERT_EQ(packet.calculateLength(), raw.size() - 32 + 16 - 12 + 16);
+
+    // Invalid AVP is met while deploying
+    ByteArray byteArray = ByteArray::fromHex("0102");
+
+    packet.updateLength();
+
+    ASSERT_THROW(packet.deploy(byteArray), std::logic_error);
+    ASSERT_EQ(byteArray, ByteArray::fromHex("0102"));
+
+    packet.avp(0).updateLength();
+
+    packet.deploy(byteArray);
+
+    ASSERT_EQ(byteArray.size(), 2 + packet.calculateLength());
+    ASSERT_EQ(Diameter::Packet(byteArray.mid(2, byteArray.size() - 2)).calculateLength(), packet.calculateLength());
+
+    // AVP is grown through kept reference
+    ByteArray grown;
+    grown.appendMultiple<uint8_t>('x', 64);
+
+    Diameter::Packet kept(raw);
+
+    auto& reference = kept.avp(2);
+
+    reference.data().setOctetString(grown);
+    reference.updateLength();
+
+    ASSERT_EQ(kept.calculateLength(), raw.size() - 36 + 72);
+    ASSERT_THROW(kept.deploy(), std::logic_error);
+    ASSERT_EQ(kept.deploy(false).size(), kept.calculateLength());
+
+    kept.updateLength();
+
+    ASSERT_EQ(kept.calculateLength(), raw.size() - 36 + 72);
+    ASSERT_EQ(Diameter::Packet(kept.deploy()).avp(2).data().toOctetString(), grown);
+
+    // Copy does not share references
+    Diameter::Packet copied(kept);
+
+    ASSERT_EQ(copied.calculateLength(), kept.calculateLength());
+    ASSERT_EQ(copied.deploy(), kept.deploy());
+
+    // Moved packet is empty
+    Diameter::Packet moved(std::move(copied));
+
+    ASSERT_EQ(moved.calculateLength(), kept.calculateLength());
+    ASSERT_EQ(copied.numberOfAVPs(), 0);
+    ASSERT_EQ(copied.calculateLength(), static_cast<uint32_t>(Diameter::Packet::Header::Size));
+
+    // Reference is not followed after length update,
+    // but packet is not written past its length
+    reference.data().setOctetString(raw);
+    reference.updateLength();
+
+    ASSERT_EQ(kept.calculateLength(), raw.size() - 36 + 72);
+    ASSERT_THROW(kept.deploy(), std::logic_error);
+    ASSERT_THROW(kept.deploy(false), std::logic_error);
+
+    // AVP is shrunk through reference after length update,
+    // so packet is not written with zero tail
+    Diameter::Packet shrunk(raw);
+
+    auto& shrunkReference = shrunk.avp(0);
+
+    shrunk.updateLength();
+
+    shrunkReference.data().setUnsigned32(1);
+    shrunkReference.updateLength();
+    shrunk.updateLength();
+
+    ASSERT_FALSE(shrunk.isValid());
+    ASSERT_THROW(shrunk.deploy(), std::logic_error);
+    ASSERT_THROW(shrunk.deploy(false), std::logic_error);
+
+    std::vector<uint8_t> memory(shrunk.calculateLength());
+
+    ASSERT_THROW(shrunk.deploy(memory.data()), std::logic_error);
+
+    ByteArray batch;
+    std::vector<std::size_t> offsets;
+
+    ASSERT_THROW(Diameter::BatchEncoder::encode({shrunk}, batch, offsets, false), std::logic_error);
+}
+
+TEST(Serialization, GroupedAVP)
+{
+    auto leaf = [](uint32_t code, const char* value)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+            )
+            .setData(
+                Diameter::AVP::Data()
+                    .setOctetString(ByteArray::fromASCII(value))
+            )
+            .updateLength();
+    };
+
+    auto group = [](uint32_t code, const Diameter::AVP::Data& data)
+    {
+        return Diameter::AVP()
+            .setHeader(
+                Diameter::AVP::Header()
+                    .setAVPCode(code)
+            )
+            .setData(data)
+            .updateLength();
+    };
+
+    // 873 -> 874 -> {2, 3}
+    auto grouped = group(873, Diameter::AVP::Data()
+        .addAVP(group(874, Diameter::AVP::Data()
+            .addAVP(leaf(2, "a"))
+            .addAVP(leaf(3, "bcdef"))
+        ))
+    );
+
+    // Same AVP from serialized children
+    ByteArray inner;
+    leaf(2, "a").deploy(inner);
+    leaf(3, "bcdef").deploy(inner);
+
+    ByteArray outer;
+    group(874, Diameter::AVP::Data(inner)).deploy(outer);
+
+    auto expected = group(873, Diameter::AVP::Data(outer)).deploy();
+
+    ASSERT_EQ(grouped.calculateLength(false), 8 + 8 + 12 + 16);
+    ASSERT_TRUE(grouped.isValid());
+    ASSERT_EQ(grouped.deploy(), expected);
+
+    auto children = grouped.data().toAVPs();
+
+    ASSERT_EQ(children.size(), 1);
+    ASSERT_EQ(children[0].data().toAVPs().size(), 2);
+
+    // Raw bytes before added AVP
+    auto mixed = Diameter::AVP::Data(inner)
+        .addAVP(leaf(4, "xy"));
+
+    ASSERT_EQ(mixed.size(), inner.size() + 12);
+    ASSERT_EQ(mixed.toAVPs().size(), 3);
+
+    auto deployed = mixed.deploy();
+
+    // Const access does not flatten added AVPs
+    const auto& view = mixed;
+
+    ASSERT_EQ(view.data(), nullptr);
+    ASSERT_EQ(view.toOctetString(), deployed);
+    ASSERT_EQ(view.data(), nullptr);
+
+    // Contiguous value is flattened once
+    ASSERT_TRUE(std::equal(deployed.begin(), deployed.end(), mixed.flatten().data()));
+    ASSERT_EQ(mixed.deploy(), deployed);
+    ASSERT_EQ(mixed.size(), deployed.size());
+
+    // Setting value drops added AVPs
+    ASSERT_EQ(mixed.setUnsigned32(5).size(), 4);
+}
+
+TEST(Serialization, InlineValue)
+{
+    auto small = ByteArray::fromASCII("client.example.com.local");
+    auto big = ByteArray::fromASCII("client.example.com.local.");
+
+    ASSERT_EQ(small.size(), Diameter::AVP::Data::InlineSize);
+
+    for (auto value : {small, big})
+    {
+        Diameter::AVP::Data data(value);
+
+        auto copy = data;
+        auto moved = std::move(copy);
+
+        ASSERT_EQ(moved.size(), value.size());
+        ASSERT_EQ(moved.toOctetString(), value);
+        ASSERT_EQ(moved.deploy(), value);
+        ASSERT_TRUE(std::equal(value.begin(), value.end(), moved.data()));
+        ASSERT_EQ(Diameter::AVP::Data(value.data(), value.size()).toOctetString(), value);
+    }
+
+    Diameter::AVP::Data data(big);
+
+    // Switching between heap and inline value
+    ASSERT_EQ(data.setUnsigned64(0x0102030405060708).deploy(), ByteArray::fromHex("0102030405060708"));
+    ASSERT_EQ(data.toUnsigned64(), 0x0102030405060708);
+    ASSERT_EQ(data.setInteger32(-2).toInteger32(), -2);
+    ASSERT_EQ(data.setOctetString(big).toOctetString(), big);
+    ASSERT_THROW(data.toUnsigned32(), std::invalid_argument);
+
+    auto child = Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(1)
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .setUnsigned32(7)
+        )
+        .updateLength();
+
+    // Flattened AVPs stay inline while they fit
+    auto grouped = Diameter::AVP::Data()
+        .setUnsigned32(1)
+        .addAVP(child);
+
+    ASSERT_EQ(grouped.flatten().toOctetString(), ByteArray::fromHex("00000001000000010000000c00000007"));
+
+    grouped.addAVP(child);
+
+    ASSERT_EQ(grouped.flatten().toOctetString(), ByteArray::fromHex("00000001000000010000000c00000007000000010000000c00000007"));
+
+    // Integer is read from added AVP without flattening
+    auto empty = Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(1)
+        )
+        .updateLength();
+
+    ASSERT_EQ(Diameter::AVP::Data().addAVP(empty).toUnsigned64(), 0x0000000100000008);
+}
+
+TEST(Serialization, PeekHeader)
+{
+    Diameter::Packet::Header header;
+
+    ASSERT_TRUE(Diameter::Packet::Header::peek(raw.data(), raw.size(), header));
+
+    ASSERT_EQ(header.version(), 1);
+    ASSERT_EQ(header.messageLength(), 100);
+    ASSERT_TRUE(header.commandFlags().isSet(Diameter::Packet::Header::Flags::Bits::Request));
+    ASSERT_EQ(header.commandCode(), 282);
+    ASSERT_EQ(header.applicationId(), 0);
+    ASSERT_EQ(header.hbhIdentifier(), 0x7ddf9367);
+    ASSERT_EQ(header.eteIdentifier(), 0xc15ecb12);
+
+    // Header is untouched on failure
+    ASSERT_FALSE(Diameter::Packet::Header::peek(raw.data(), 19, header));
+    ASSERT_EQ(header.commandCode(), 282);
+}
+
+TEST(Serialization, TryParseAVP)
+{
+    Diameter::AVP avp;
+
+    // Last AVP without padding
+    auto result = Diameter::AVP::tryParse(raw.data() + 64, 33, avp);
+
+    ASSERT_TRUE(result.isOk());
+    ASSERT_EQ(avp.header().avpCode(), 296);
+    ASSERT_EQ(avp.data().toOctetString(), ByteArray::fromASCII("custom.testing.server.com"));
+
+    result = Diameter::AVP::tryParse(raw.data() + 64, 6, avp);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::AVPHeaderTooSmall);
+    ASSERT_EQ(result.avpCode(), 296);
+
+    Diameter::AVP::Data::AVPContainer container;
+
+    auto grouped = Diameter::AVP::Data(raw.mid(20, 44));
+
+    ASSERT_TRUE(grouped.tryToAVPs(container).isOk());
+    ASSERT_EQ(container.size(), 2);
+
+    grouped = Diameter::AVP::Data(raw.mid(20, 40));
+
+    result = grouped.tryToAVPs(container);
+
+    ASSERT_EQ(result.code(), Diameter::ParseResult::Code::AVPLengthTooLarge);
+    ASSERT_EQ(result.offset(), 32);
+    ASSERT_EQ(container.size(), 2);
+}
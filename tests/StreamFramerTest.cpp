@@ -0,0 +1,108 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/StreamFramer.hpp>
+#include <Diameter/PacketView.hpp>
+#include <algorithm>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(StreamFramer, WholeChunk)
+{
+    ByteArray stream;
+
+    stream.append(raw);
+    stream.append(raw);
+    stream.append(raw);
+
+    Diameter::StreamFramer framer(1024);
+
+    framer.feed(stream.data(), stream.size());
+
+    const uint8_t* message;
+    uint32_t size;
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(framer.next(message, size), Diameter::StreamFramer::Status::Message);
+
+        // Handed out in place
+        ASSERT_EQ(message, stream.data() + i * raw.size());
+        ASSERT_EQ(size, raw.size());
+    }
+
+    ASSERT_EQ(framer.next(message, size), Diameter::StreamFramer::Status::NeedMoreData);
+    ASSERT_EQ(framer.buffered(), 0);
+}
+
+TEST(StreamFramer, SplitChunks)
+{
+    ByteArray stream;
+
+    stream.append(raw);
+    stream.append(raw);
+
+    // Trying every chunk size, including chunks
+    // smaller than header
+    for (uint32_t chunkSize = 1; chunkSize <= stream.size(); ++chunkSize)
+    {
+        Diameter::StreamFramer framer(raw.size());
+
+        uint32_t messages = 0;
+
+        for (uint32_t offset = 0; offset < stream.size(); offset += chunkSize)
+        {
+            auto size = std::min<uint32_t>(chunkSize, stream.size() - offset);
+
+            framer.feed(stream.data() + offset, size);
+
+            const uint8_t* message;
+            uint32_t messageSize;
+
+            while (framer.next(message, messageSize) == Diameter::StreamFramer::Status::Message)
+            {
+                ASSERT_EQ(messageSize, raw.size());
+                ASSERT_TRUE(std::equal(message, message + messageSize, raw.begin()));
+                ++messages;
+            }
+        }
+
+        ASSERT_EQ(messages, 2);
+        ASSERT_EQ(framer.buffered(), 0);
+    }
+}
+
+TEST(StreamFramer, Errors)
+{
+    const uint8_t* message;
+    uint32_t size;
+
+    Diameter::StreamFramer framer(64);
+
+    framer.feed(raw.data(), raw.size());
+
+    ASSERT_EQ(framer.next(message, size), Diameter::StreamFramer::Status::TooLarge);
+
+    framer.reset();
+
+    auto broken = raw;
+    broken[3] = 4;
+
+    framer.feed(broken.data(), broken.size());
+
+    ASSERT_EQ(framer.next(message, size), Diameter::StreamFramer::Status::InvalidLength);
+
+    ASSERT_ANY_THROW(framer.feed(raw.data(), raw.size()));
+
+    ASSERT_ANY_THROW(Diameter::StreamFramer(4));
+}
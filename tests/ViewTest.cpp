@@ -0,0 +1,170 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/PacketView.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(View, Header)
+{
+    Diameter::PacketView view;
+
+    ASSERT_NO_THROW(view = Diameter::PacketView(raw));
+
+    ASSERT_TRUE(view.isValid());
+
+    ASSERT_EQ(view.version(), 1);
+    ASSERT_EQ(view.messageLength(), raw.size());
+    ASSERT_EQ(view.commandFlags().isSet(
+        Diameter::Packet::Header::Flags::Bits::Request
+    ), true);
+    ASSERT_EQ(view.commandCode(), 282);
+    ASSERT_EQ(view.applicationId(), 0);
+    ASSERT_EQ(view.hbhIdentifier(), 0x7ddf9367);
+    ASSERT_EQ(view.eteIdentifier(), 0xc15ecb12);
+}
+
+TEST(View, AVPs)
+{
+    Diameter::PacketView view(raw);
+
+    ASSERT_EQ(view.numberOfAVPs(), 3);
+
+    auto originHostAVP = view.avp(0);
+
+    ASSERT_EQ(originHostAVP.avpCode(), 264);
+    ASSERT_EQ(originHostAVP.length(), 32);
+    ASSERT_EQ(originHostAVP.flags().isSet(
+        Diameter::AVP::Header::Flags::Bits::Mandatory
+    ), true);
+    ASSERT_ANY_THROW(originHostAVP.vendorId());
+    ASSERT_EQ(
+        originHostAVP.toOctetString(),
+        ByteArray::fromASCII("n1.custom.tcp.server.com")
+    );
+
+    ASSERT_EQ(view.avp(1).avpCode(), 273);
+    ASSERT_EQ(view.avp(1).toUnsigned32(), 0);
+    ASSERT_ANY_THROW(view.avp(1).toUnsigned64());
+
+    ASSERT_EQ(view.avp(2).length(), 33);
+    ASSERT_EQ(view.avp(2).dataSize(), 25);
+
+    ASSERT_ANY_THROW(view.avp(3));
+
+    uint32_t count = 0;
+
+    for (auto avp : view)
+    {
+        ASSERT_EQ(avp.raw(), view.avp(count).raw());
+        ++count;
+    }
+
+    ASSERT_EQ(count, view.numberOfAVPs());
+}
+
+TEST(View, ToPacket)
+{
+    Diameter::PacketView view(raw);
+
+    ASSERT_EQ(view.toPacket().deploy(), raw);
+}
+
+TEST(View, Grouped)
+{
+    auto inner = Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(444)
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .setOctetString(ByteArray::fromASCII("12345"))
+        )
+        .updateLength();
+
+    auto grouped = Diameter::AVP()
+        .setHeader(
+            Diameter::AVP::Header()
+                .setAVPCode(443)
+                .setFlags(
+                    Diameter::AVP::Header::Flags()
+                        .setFlag(Diameter::AVP::Header::Flags::Bits::VendorSpecific, true)
+                )
+                .setVendorID(10415)
+        )
+        .setData(
+            Diameter::AVP::Data()
+                .addAVP(inner)
+                .addAVP(inner)
+        )
+        .updateLength()
+        .deploy();
+
+    Diameter::AVPView view(grouped.data(), grouped.size());
+
+    ASSERT_EQ(view.avpCode(), 443);
+    ASSERT_EQ(view.vendorId(), 10415);
+    ASSERT_EQ(view.headerSize(), 12);
+
+    uint32_t count = 0;
+
+    for (auto child : view)
+    {
+        ASSERT_EQ(child.avpCode(), 444);
+        ASSERT_EQ(child.toOctetString(), ByteArray::fromASCII("12345"));
+        ++count;
+    }
+
+    ASSERT_EQ(count, 2);
+    ASSERT_TRUE(view.checkChildren().isOk());
+
+    // Length of second child is larger than value
+    grouped[12 + 16 + 7] = 64;
+
+    view = Diameter::AVPView(grouped.data(), grouped.size());
+
+    count = 0;
+
+    for (auto child : view)
+    {
+        ASSERT_EQ(child.avpCode(), 444);
+        ++count;
+    }
+
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(view.checkChildren().code(), Diameter::ParseResult::Code::AVPLengthTooLarge);
+    ASSERT_EQ(view.checkChildren().offset(), 16);
+    ASSERT_EQ(view.checkChildren().avpCode(), 444);
+
+    // Length of first child is smaller than header
+    grouped[12 + 7] = 4;
+
+    ASSERT_TRUE(view.begin() == view.end());
+    ASSERT_EQ(view.checkChildren().code(), Diameter::ParseResult::Code::AVPLengthTooSmall);
+    ASSERT_EQ(view.checkChildren().offset(), 0);
+}
+
+TEST(View, Malformed)
+{
+    ASSERT_ANY_THROW(Diameter::PacketView(raw.data(), Diameter::Packet::Header::Size - 1));
+
+    // Cutting last AVP
+    ASSERT_ANY_THROW(Diameter::PacketView(raw.data(), raw.size() - 4));
+
+    // AVP length smaller than AVP header
+    auto broken = raw;
+    broken[Diameter::Packet::Header::Size + 7] = 4;
+
+    ASSERT_ANY_THROW(Diameter::PacketView(broken.data(), broken.size()));
+}
@@ -0,0 +1,51 @@
+//
+// Created by megaxela on 10/17/26.
+//
+
+#include <gtest/gtest.h>
+#include <Diameter/PacketPool.hpp>
+#include <AllocationCounter.hpp>
+
+static const ByteArray raw = ByteArray::fromHex(
+        "010000648000011a000000007ddf9367"
+        "c15ecb1200000108400000206e312e63"
+        "7573746f6d2e7463702e736572766572"
+        "2e636f6d000001114000000c00000000"
+        "0000012840000021637573746f6d2e74"
+        "657374696e672e7365727665722e636f"
+        "6d000000"
+);
+
+TEST(PacketPool, SteadyState)
+{
+    for (auto mode : {Diameter::Packet::ParseMode::Eager,
+                      Diameter::Packet::ParseMode::Lazy,
+                      Diameter::Packet::ParseMode::Memoized})
+    {
+        Diameter::PacketPool pool(1);
+
+        auto packet = pool.acquire();
+
+        ASSERT_TRUE(Diameter::Packet::tryParse(raw.data(), raw.size(), packet, mode).isOk());
+
+        // Value of last AVP does not fit inline
+        ASSERT_GT(packet.avp(2).data().size(), Diameter::AVP::Data::InlineSize);
+
+        pool.release(std::move(packet));
+
+        auto allocations = AllocationCounter::allocations();
+
+        packet = pool.acquire();
+
+        auto result = Diameter::Packet::tryParse(raw.data(), raw.size(), packet, mode);
+        auto found = packet.find(296);
+        auto length = packet.avp(2).data().size();
+
+        pool.release(std::move(packet));
+
+        ASSERT_EQ(AllocationCounter::allocations(), allocations);
+        ASSERT_TRUE(result.isOk());
+        ASSERT_EQ(found, 2);
+        ASSERT_EQ(length, 25);
+    }
+}